@@ -1,5 +1,3 @@
-#define _XOPEN_SOURCE		// IOV_MAX
-
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -7,8 +5,6 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <errno.h>
-#include <limits.h>
-#include <sys/uio.h>
 #include "../include/libbase64.h"
 
 // Size of the buffer for the "raw" (not base64-encoded) data in bytes.
@@ -18,6 +14,10 @@
 // data is 4/3 the size of the input, with some margin to be sure.
 #define BUFFER_ENC_SIZE (BUFFER_RAW_SIZE * 4 / 3 + 16)
 
+// Size of the buffer for the wrapped base64-encoded data in bytes, which adds
+// a newline for every line of `wrap` characters.
+#define BUFFER_ENC_SIZE_WRAPPED(wrap) (BUFFER_ENC_SIZE + BUFFER_ENC_SIZE / (wrap) + 1)
+
 // Global config structure.
 struct config {
 
@@ -53,8 +53,12 @@ struct buffer {
 static bool
 buffer_alloc (const struct config *config, struct buffer *buf)
 {
+	const size_t enc_size = (config->wrap > 0)
+		? BUFFER_ENC_SIZE_WRAPPED(config->wrap)
+		: BUFFER_ENC_SIZE;
+
 	if ((buf->raw = malloc(BUFFER_RAW_SIZE)) == NULL ||
-	    (buf->enc = malloc(BUFFER_ENC_SIZE)) == NULL) {
+	    (buf->enc = malloc(enc_size)) == NULL) {
 		free(buf->raw);
 		fprintf(stderr, "%s: malloc: %s\n",
 		        config->name, strerror(errno));
@@ -71,76 +75,6 @@ buffer_free (struct buffer *buf)
 	free(buf->enc);
 }
 
-static bool
-writev_retry (const struct config *config, struct iovec *iov, size_t nvec)
-{
-	// Writing nothing always succeeds.
-	if (nvec == 0) {
-		return true;
-	}
-
-	while (true) {
-		ssize_t nwrite;
-
-		// Try to write the vectors to stdout.
-		if ((nwrite = writev(1, iov, nvec)) < 0) {
-
-			// Retry on EINTR.
-			if (errno == EINTR) {
-				continue;
-			}
-
-			// Quit on other errors.
-			fprintf(stderr, "%s: writev: %s\n",
-				config->name, strerror(errno));
-			return false;
-		}
-
-		// The return value of `writev' is the number of bytes written.
-		// To check for success, we traverse the list and remove all
-		// written vectors. The call succeeded if the list is empty.
-		while (true) {
-
-			// Retry if this vector is not or partially written.
-			if (iov->iov_len > (size_t) nwrite) {
-				char *base = iov->iov_base;
-
-				iov->iov_base = (size_t) nwrite + base;
-				iov->iov_len -= (size_t) nwrite;
-				break;
-			}
-
-			// Move to the next vector.
-			nwrite -= iov->iov_len;
-			iov++;
-
-			// Return successfully if all vectors were written.
-			if (--nvec == 0) {
-				return true;
-			}
-		}
-	}
-}
-
-static inline bool
-iov_append (const struct config *config, struct iovec *iov,
-            size_t *nvec, char *base, const size_t len)
-{
-	// Add the buffer to the IO vector array.
-	iov[*nvec].iov_base = base;
-	iov[*nvec].iov_len  = len;
-
-	// Increment the array index. Flush the array if it is full.
-	if (++(*nvec) == IOV_MAX) {
-		if (writev_retry(config, iov, IOV_MAX) == false) {
-			return false;
-		}
-		*nvec = 0;
-	}
-
-	return true;
-}
-
 static bool
 write_stdout (const struct config *config, const char *buf, size_t len)
 {
@@ -169,73 +103,17 @@ write_stdout (const struct config *config, const char *buf, size_t len)
 	return true;
 }
 
-static bool
-write_wrapped (const struct config *config, char *buf, size_t len)
-{
-	static size_t col = 0;
-
-	// Special case: if buf is NULL, print final trailing newline.
-	if (buf == NULL) {
-		if (config->wrap > 0 && col > 0) {
-			return write_stdout(config, "\n", 1);
-		}
-		return true;
-	}
-
-	// If no wrap width is given, write the entire buffer.
-	if (config->wrap == 0) {
-		return write_stdout(config, buf, len);
-	}
-
-	// Statically allocated IO vector buffer.
-	static struct iovec iov[IOV_MAX];
-	size_t nvec = 0;
-
-	while (len > 0) {
-
-		// Number of characters to fill the current line.
-		size_t nwrite = config->wrap - col;
-
-		// Do not write more data than is available.
-		if (nwrite > len) {
-			nwrite = len;
-		}
-
-		// Append the data to the IO vector array.
-		if (iov_append(config, iov, &nvec, buf, nwrite) == false) {
-			return false;
-		}
-
-		// Advance the buffer.
-		len -= nwrite;
-		buf += nwrite;
-		col += nwrite;
-
-		// If the line is full, append a newline.
-		if (col == config->wrap) {
-			if (iov_append(config, iov, &nvec, "\n", 1) == false) {
-				return false;
-			}
-			col = 0;
-		}
-	}
-
-	// Write the remaining vectors.
-	if (writev_retry(config, iov, nvec) == false) {
-		return false;
-	}
-
-	return true;
-}
-
 static bool
 encode (const struct config *config, struct buffer *buf)
 {
 	size_t nread, nout;
 	struct base64_state state;
 
-	// Initialize the encoder's state structure.
+	// Initialize the encoder's state structure. Let the encoder wrap the
+	// lines. Unwrapped output is encoded on all cores.
 	base64_stream_encode_init(&state, 0);
+	base64_stream_set_wrap(&state, config->wrap, 0);
+	base64_stream_set_threads(&state, 0);
 
 	// Read raw data into the buffer.
 	while ((nread = fread(buf->raw, 1, BUFFER_RAW_SIZE, config->fp)) > 0) {
@@ -244,7 +122,7 @@ encode (const struct config *config, struct buffer *buf)
 		base64_stream_encode(&state, buf->raw, nread, buf->enc, &nout);
 
 		// Append the encoded data to the output stream.
-		if (write_wrapped(config, buf->enc, nout) == false) {
+		if (write_stdout(config, buf->enc, nout) == false) {
 			return false;
 		}
 	}
@@ -259,13 +137,9 @@ encode (const struct config *config, struct buffer *buf)
 	// Finalize the encoding by adding proper stream terminators.
 	base64_stream_encode_final(&state, buf->enc, &nout);
 
-	// Append this tail to the output stream.
-	if (write_wrapped(config, buf->enc, nout) == false) {
-		return false;
-	}
-
-	// Print optional trailing newline.
-	if (write_wrapped(config, NULL, 0) == false) {
+	// Append this tail, and the trailing newline if wrapping, to the
+	// output stream.
+	if (write_stdout(config, buf->enc, nout) == false) {
 		return false;
 	}
 
@@ -278,8 +152,9 @@ decode (const struct config *config, struct buffer *buf)
 	size_t nread, nout;
 	struct base64_state state;
 
-	// Initialize the decoder's state structure.
-	base64_stream_decode_init(&state, 0);
+	// Initialize the decoder's state structure. Skip the line breaks that
+	// the encoder inserts when wrapping.
+	base64_stream_decode_init(&state, BASE64_IGNORE_SPACE);
 
 	// Read encoded data into the buffer. Use the smallest buffer size to
 	// be on the safe side: the decoded output will fit the raw buffer.
@@ -55,11 +55,80 @@ extern "C" {
 #define BASE64_FORCE_AVX	(1 << 7)
 #define BASE64_FORCE_AVX512	(1 << 8)
 
+/* These flags select the alphabet and the padding, and can be combined with
+ * the codec flags above. BASE64_URLSAFE selects the "URL and filename safe"
+ * alphabet of RFC 4648 section 5, which has '-' and '_' in place of '+' and
+ * '/'. BASE64_NOPAD leaves out the trailing '=' characters when encoding, and
+ * accepts input without them when decoding. Pass the same flags to the
+ * encoder and the decoder: */
+#define BASE64_URLSAFE		(1 << 16)
+#define BASE64_NOPAD		(1 << 17)
+
+/* When decoding, BASE64_IGNORE_SPACE skips the whitespace characters space,
+ * '\t', '\n', '\v', '\f' and '\r' anywhere in the input, such as the line
+ * breaks in MIME and PEM data. It has no effect on the encoder: */
+#define BASE64_IGNORE_SPACE	(1 << 18)
+
+/* These flags select the decoding policy. BASE64_STRICT rejects input with
+ * nonzero bits in the unused low bits of the last character, so that every
+ * output has exactly one valid encoding, as needed for signature checks.
+ * BASE64_FORGIVING follows the forgiving-base64 decode of the WHATWG Infra
+ * standard: ASCII whitespace (space, '\t', '\n', '\f' and '\r') is skipped,
+ * and the padding may be left out, but must be complete if present.
+ * BASE64_FORBID_PAD rejects the '=' character, as required for base64url in
+ * many protocols, and leaves it out when encoding like BASE64_NOPAD: */
+#define BASE64_STRICT		(1 << 19)
+#define BASE64_FORGIVING	(1 << 20)
+#define BASE64_FORBID_PAD	(1 << 21)
+
+/* When encoding, BASE64_NONTEMPORAL writes the output with non-temporal
+ * stores, which go straight to memory instead of pulling the output into the
+ * cache, and prefetches the input. Use it for large output that will not be
+ * read back soon, such as a buffer that goes to a file. The x86 SIMD encoders
+ * do this by themselves for calls with more input than fits in a typical
+ * last-level cache. It has no effect on the decoder: */
+#define BASE64_NONTEMPORAL	(1 << 22)
+
+/* Storage for a custom alphabet, filled in by base64_alphabet_init(). The
+ * contents are private to the library. They include the generated lookup
+ * tables, which is why the struct is fairly large: */
+struct base64_alphabet {
+	union {
+		unsigned char	 bytes[16384];
+		void		*align_ptr;
+		long long	 align_ll;
+		double		 align_dbl;
+	} opaque;
+};
+
+/* Storage for a set of ignored bytes and sequences, filled in by
+ * base64_ignore_init(). The contents are private to the library: */
+struct base64_ignore {
+	union {
+		unsigned char	 bytes[512];
+		void		*align_ptr;
+		long long	 align_ll;
+		double		 align_dbl;
+	} opaque;
+};
+
+/* The codec chosen for a state at init time. Opaque to the user: */
+struct base64_codec;
+
 struct base64_state {
 	int eof;
 	int bytes;
 	int flags;
 	unsigned char carry;
+	const struct base64_alphabet *alphabet;
+	const struct base64_ignore *ignore;
+	int ignore_bytes;
+	unsigned char ignore_carry[3];
+	size_t wrap;
+	size_t wrap_col;
+	int wrap_crlf;
+	const struct base64_codec *codec;
+	int threads;
 };
 
 /* Wrapper function to encode a plain string of given length. Output is written
@@ -74,6 +143,17 @@ void BASE64_EXPORT base64_encode
 	, int			 flags
 	) ;
 
+/* Same as base64_encode(), but encodes the `len` bytes at the start of `buf`
+ * over themselves. The buffer must have room for base64_encoded_length(len,
+ * flags) bytes. The output is built from the back of the buffer, on the
+ * calling thread: */
+void BASE64_EXPORT base64_encode_inplace
+	( char			*buf
+	, size_t		 len
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
 /* Call this before calling base64_stream_encode() to init the state. See above
  * for `flags`; set to 0 for default operation: */
 void BASE64_EXPORT base64_stream_encode_init
@@ -104,6 +184,19 @@ void BASE64_EXPORT base64_stream_encode_final
 	, size_t		*outlen
 	) ;
 
+/* Call this after base64_stream_encode_init() to wrap the output in lines of
+ * `cols` characters, such as 76 for MIME and 64 for PEM, ending in "\n", or in
+ * "\r\n" if `crlf` is nonzero. Set `cols` to 0 to turn wrapping off. The line
+ * position is kept in the state across calls. A line break is written before
+ * the first character of every line but the first, and
+ * base64_stream_encode_final() ends the last line with one, unless the output
+ * is empty. Allow for the line breaks when sizing the output buffer: */
+void BASE64_EXPORT base64_stream_set_wrap
+	( struct base64_state	*state
+	, size_t		 cols
+	, int			 crlf
+	) ;
+
 /* Wrapper function to decode a plain string of given length. Output is written
  * to *out without trailing zero. Output length in bytes is written to *outlen.
  * The buffer in `out` has been allocated by the caller and is at least 3/4 the
@@ -116,6 +209,16 @@ int BASE64_EXPORT base64_decode
 	, int			 flags
 	) ;
 
+/* Same as base64_decode(), but decodes the string in `buf` over itself. The
+ * output starts at `buf`, and its length is written to `outlen`. The input is
+ * always decoded on the calling thread: */
+int BASE64_EXPORT base64_decode_inplace
+	( char			*buf
+	, size_t		 len
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
 /* Call this before calling base64_stream_decode() to init the state. See above
  * for `flags`; set to 0 for default operation: */
 void BASE64_EXPORT base64_stream_decode_init
@@ -139,6 +242,259 @@ int BASE64_EXPORT base64_stream_decode
 	, size_t		*outlen
 	) ;
 
+/* Builds the lookup tables for a custom alphabet, given as the 64 characters
+ * at `chars` (not necessarily zero-terminated) in order of their value, and a
+ * padding character `pad`. Pass '\0' as `pad` for an alphabet without padding,
+ * such as the one used by bcrypt. All characters must be distinct 7-bit ASCII
+ * characters. Returns 1 on success, and 0 if the alphabet is invalid. The
+ * alphabet contains pointers to itself, so initialize every copy instead of
+ * copying it: */
+int BASE64_EXPORT base64_alphabet_init
+	( struct base64_alphabet	*alphabet
+	, const char			*chars
+	, char				 pad
+	) ;
+
+/* Call this after base64_stream_encode_init() or base64_stream_decode_init()
+ * to use a custom alphabet instead of the alphabet selected by the flags. The
+ * alphabet must remain valid for as long as the state is in use: */
+void BASE64_EXPORT base64_stream_set_alphabet
+	( struct base64_state		*state
+	, const struct base64_alphabet	*alphabet
+	) ;
+
+/* Builds a set of bytes and byte sequences for the decoder to skip. `bytes` is
+ * a string of single bytes to skip, and `seqs` is a NULL-terminated list of
+ * strings of up to 4 bytes, such as the "\\n" escapes found in JSON strings.
+ * Either may be NULL. At most 8 sequences of two or more bytes are allowed.
+ * Where sequences overlap, the shortest one that matches is skipped. Returns 1
+ * on success, and 0 if a sequence is empty, too long or one too many: */
+int BASE64_EXPORT base64_ignore_init
+	( struct base64_ignore	*ignore
+	, const char		*bytes
+	, const char *const	*seqs
+	) ;
+
+/* Call this after base64_stream_decode_init() to skip the bytes and sequences
+ * in `ignore` instead of the whitespace selected by BASE64_IGNORE_SPACE. The
+ * set must remain valid for as long as the state is in use. If the input ends
+ * in the middle of a sequence, its first bytes are kept in the state, and
+ * `ignore_bytes` is nonzero after the last call to base64_stream_decode(): */
+void BASE64_EXPORT base64_stream_set_ignore
+	( struct base64_state		*state
+	, const struct base64_ignore	*ignore
+	) ;
+
+/* Checks whether the string of given length at `src` would decode without
+ * error with base64_decode() and the same `flags`, without decoding it. Returns
+ * 1 if so, and 0 if not. If `decoded_len` is not NULL, the length of the
+ * decoded output is written to it; on error, the length of the output of the
+ * characters before the error. If `error_offset` is not NULL, the offset of
+ * the first invalid byte is written to it, or `srclen` if the input is valid
+ * or ends too early: */
+int BASE64_EXPORT base64_validate
+	( const char		*src
+	, size_t		 srclen
+	, int			 flags
+	, size_t		*decoded_len
+	, size_t		*error_offset
+	) ;
+
+/* Returns the exact length of the output of base64_encode() for `srclen`
+ * bytes of input with the given `flags`: */
+size_t BASE64_EXPORT base64_encoded_length
+	( size_t		 srclen
+	, int			 flags
+	) ;
+
+/* Returns the largest possible length of the output of base64_decode() for
+ * `srclen` bytes of input. Use base64_validate() for the exact length: */
+size_t BASE64_EXPORT base64_decoded_length_max
+	( size_t		 srclen
+	) ;
+
+/* Same as base64_encode(), but writes at most `outcap` bytes to `out`.
+ * Returns 1 on success, and 0 without writing anything if the output does not
+ * fit: */
+int BASE64_EXPORT base64_encode_bounded
+	( const char		*src
+	, size_t		 srclen
+	, char			*out
+	, size_t		 outcap
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
+/* Same as base64_decode(), but never writes beyond the first `outcap` bytes
+ * of `out`, which may be just large enough to hold the output. Returns 0 if
+ * the input is invalid or if the output does not fit: */
+int BASE64_EXPORT base64_decode_bounded
+	( const char		*src
+	, size_t		 srclen
+	, char			*out
+	, size_t		 outcap
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
+/* Fixed-width encoders for common identifier and digest sizes: UUIDs (16
+ * bytes), SHA-1 (20), SHA-256 (32), SHA-384 (48) and 64-byte signatures. They
+ * encode exactly that many bytes at `src` into base64_encoded_length(n, flags)
+ * characters at `out`. Codec flags select the codec, whose SIMD kernel for
+ * the size is used if it has one: */
+void BASE64_EXPORT base64_encode_16 (const char *src, char *out, int flags);
+void BASE64_EXPORT base64_encode_20 (const char *src, char *out, int flags);
+void BASE64_EXPORT base64_encode_32 (const char *src, char *out, int flags);
+void BASE64_EXPORT base64_encode_48 (const char *src, char *out, int flags);
+void BASE64_EXPORT base64_encode_64 (const char *src, char *out, int flags);
+
+/* The matching fixed-width decoders. They read exactly
+ * base64_encoded_length(n, flags) characters at `src`, which are padded unless
+ * BASE64_NOPAD or BASE64_FORBID_PAD is set, and write exactly `n` bytes to
+ * `out`. No bytes are skipped. Return 1 on success, and 0 without touching the
+ * output if the input is invalid: */
+int BASE64_EXPORT base64_decode_16 (const char *src, char *out, int flags);
+int BASE64_EXPORT base64_decode_20 (const char *src, char *out, int flags);
+int BASE64_EXPORT base64_decode_32 (const char *src, char *out, int flags);
+int BASE64_EXPORT base64_decode_48 (const char *src, char *out, int flags);
+int BASE64_EXPORT base64_decode_64 (const char *src, char *out, int flags);
+
+/* Encodes `count` independent buffers in one call. Item `i` is the
+ * `srclen[i]` bytes at `src[i]`. The outputs are written back to back to the
+ * arena at `out`, which must hold the sum of base64_encoded_length() of the
+ * items. The output of item `i` spans offsets[i] to offsets[i + 1], so that
+ * `offsets` has `count + 1` entries, and offsets[count] is the total length.
+ * Small items are gathered so that the codec encodes many of them at once: */
+void BASE64_EXPORT base64_encode_batch
+	( const char *const	*src
+	, const size_t		*srclen
+	, size_t		 count
+	, char			*out
+	, size_t		*offsets
+	, int			 flags
+	) ;
+
+/* Decodes `count` independent buffers in one call, with the same layout as
+ * base64_encode_batch(). The arena must hold the sum of
+ * base64_decoded_length_max() of the items. An item that fails to decode has
+ * no output, so that offsets[i + 1] == offsets[i]. If `results` is not NULL,
+ * results[i] is set to what base64_decode() returns for item `i`. Returns the
+ * number of items that were decoded: */
+size_t BASE64_EXPORT base64_decode_batch
+	( const char *const	*src
+	, const size_t		*srclen
+	, size_t		 count
+	, char			*out
+	, size_t		*offsets
+	, int			*results
+	, int			 flags
+	) ;
+
+/* Scatter/gather versions of base64_encode() and base64_decode(). The input
+ * is the concatenation of the `srccnt` segments at `src`, and the output is
+ * written across the `outcnt` segments at `out`, in order. The total length
+ * of the output is written to `outlen`. The input is never copied into one
+ * buffer, and the output of the codec goes straight into the segments. Both
+ * return 0 if the output does not fit; base64_decodev() also returns 0 for
+ * invalid input. struct iovec is that of <sys/uio.h>, and on Windows a
+ * structure of the same layout: */
+struct iovec;
+
+int BASE64_EXPORT base64_encodev
+	( const struct iovec	*src
+	, size_t		 srccnt
+	, const struct iovec	*out
+	, size_t		 outcnt
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
+int BASE64_EXPORT base64_decodev
+	( const struct iovec	*src
+	, size_t		 srccnt
+	, const struct iovec	*out
+	, size_t		 outcnt
+	, size_t		*outlen
+	, int			 flags
+	) ;
+
+/* Multi-threaded versions of base64_encode() and base64_decode(), for large
+ * buffers. The work is shared by the calling thread and up to `nthreads - 1`
+ * threads of a pool that the library starts on first use and keeps for later
+ * calls. If `nthreads` is zero or less, it is the number of online CPUs. The
+ * output is the same as that of the single-threaded functions, except that
+ * on invalid input, the output of base64_decode_mt() may stop short of the
+ * error, and the threads stop soon after they find it. If `error_offset` is
+ * not NULL, it is set as by base64_validate(). Without thread support in the
+ * build, both run on the calling thread: */
+void BASE64_EXPORT base64_encode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	) ;
+
+int BASE64_EXPORT base64_decode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	, size_t	*error_offset
+	) ;
+
+/* Sets the input length from which the multi-threaded functions, and
+ * base64_encode() and base64_decode() in a build with OpenMP, split the work
+ * across threads. By default it is measured on first use, for each codec,
+ * from the speed of the codec on one thread and the time it takes to wake up
+ * the threads and wait for them. The BASE64_PARALLEL_THRESHOLD environment
+ * variable overrides the default. Zero restores it: */
+void BASE64_EXPORT base64_set_parallel_threshold (size_t srclen);
+
+/* Pins the threads of the pool to the CPUs of one NUMA node each, in turn
+ * over the nodes, if `pin` is nonzero; unpins them otherwise. Takes effect
+ * from the next multi-threaded call. Has no effect on a single node: */
+void BASE64_EXPORT base64_mt_set_pinning (int pin);
+
+/* Stops the threads of the pool and waits for them to exit, after the call
+ * that uses them, if any. A later multi-threaded call starts them again: */
+void BASE64_EXPORT base64_mt_shutdown (void);
+
+/* Call this after base64_stream_encode_init() or base64_stream_decode_init()
+ * to split large calls to base64_stream_encode() and base64_stream_decode()
+ * across up to `nthreads` threads, as the multi-threaded functions do. Set to
+ * 0 for the number of online CPUs, or to 1 to turn it off, which is the
+ * default. The output is that of a single thread. Has no effect on wrapped
+ * output, on decoding with skipped bytes, or without the thread pool: */
+void BASE64_EXPORT base64_stream_set_threads
+	( struct base64_state	*state
+	, int			 nthreads
+	) ;
+
+/* Same as base64_encode(), but with a custom alphabet: */
+void BASE64_EXPORT base64_encode_alphabet
+	( const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	, const struct base64_alphabet	*alphabet
+	) ;
+
+/* Same as base64_decode(), but with a custom alphabet. If the alphabet has no
+ * padding character, the input is decoded as if BASE64_NOPAD were set: */
+int BASE64_EXPORT base64_decode_alphabet
+	( const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	, const struct base64_alphabet	*alphabet
+	) ;
+
 #ifdef __cplusplus
 }
 #endif
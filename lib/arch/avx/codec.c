@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../../../include/libbase64.h"
 #include "../../tables/tables.h"
@@ -19,17 +20,34 @@
 # endif
 #endif
 
+#include "../generic/32/dec_loop.c"
+#if BASE64_WORDSIZE == 32
+# include "../generic/32/enc_loop.c"
+#elif BASE64_WORDSIZE == 64
+# include "../generic/64/enc_loop.c"
+#endif
 #include "../ssse3/dec_reshuffle.c"
 #include "../ssse3/dec_loop.c"
+#include "../ssse3/dec_loop_lookup.c"
+#include "../ssse3/dec_loop_ignore.c"
+#include "../ssse3/span_loop.c"
+
+#include "../generic/enc_nt.c"
+#include "../ssse3/enc_reshuffle.c"
+#include "../ssse3/enc_translate.c"
+#include "../ssse3/enc_loop_lookup.c"
+#include "../ssse3/enc_loop_nt.c"
+#include "../ssse3/enc_wrap.c"
+#include "../ssse3/enc_loop_wrap.c"
 
 #if BASE64_AVX_USE_ASM
 # include "enc_loop_asm.c"
 #else
-# include "../ssse3/enc_translate.c"
-# include "../ssse3/enc_reshuffle.c"
 # include "../ssse3/enc_loop.c"
 #endif
 
+#include "../ssse3/fixed.c"
+
 #endif	// BASE64_HAVE_AVX
 
 void base64_stream_encode_avx(struct base64_state *state, const char *src, size_t srclen, char	*out, size_t *outlen)
@@ -41,12 +59,24 @@ void base64_stream_encode_avx(struct base64_state *state, const char *src, size_
 	// encoder. Otherwise fall back on the SSSE3 encoder, but compiled with
 	// AVX flags to generate better optimized AVX code.
 
+	if (tables->enc_ranges) {
+		if (base64_enc_nontemporal(state->flags, slen)) {
+			enc_loop_ssse3_nt(&s, &slen, &o, &olen, tables);
+		}
 #if BASE64_AVX_USE_ASM
-	enc_loop_avx(&s, &slen, &o, &olen);
+		enc_loop_avx(&s, &slen, &o, &olen, tables);
 #else
-	enc_loop_ssse3(&s, &slen, &o, &olen);
+		enc_loop_ssse3(&s, &slen, &o, &olen, tables);
+#endif
+	} else {
+		enc_loop_ssse3_lookup(&s, &slen, &o, &olen, tables);
+	}
+	// Encode the remaining groups with the 12-bit table:
+#if BASE64_WORDSIZE == 32
+	enc_loop_generic_32(&s, &slen, &o, &olen, tables);
+#elif BASE64_WORDSIZE == 64
+	enc_loop_generic_64(&s, &slen, &o, &olen, tables);
 #endif
-
 	#include "../generic/enc_tail.c"
 #else
 	BASE64_ENC_STUB
@@ -57,9 +87,74 @@ int	base64_stream_decode_avx(struct base64_state *state, const char *src, size_t
 {
 #if BASE64_HAVE_AVX
 	#include "../generic/dec_head.c"
-	dec_loop_ssse3(&s, &slen, &o, &olen);
+	if (tables->dec_ranges) {
+		dec_loop_ssse3(&s, &slen, &o, &olen, tables);
+	} else {
+		dec_loop_ssse3_lookup(&s, &slen, &o, &olen, tables);
+	}
+	// Decode the remaining quads with the 32-bit tables:
+	dec_loop_generic_32(&s, &slen, &o, &olen, tables);
 	#include "../generic/dec_tail.c"
 #else
 	BASE64_DEC_STUB
 #endif
 }
+
+size_t base64_stream_span_avx(const struct base64_state *state, const char *src, size_t srclen)
+{
+#if BASE64_HAVE_AVX
+	#include "../generic/span_head.c"
+	if (tables->dec_ranges) {
+		span_loop_ssse3(&s, &slen, tables);
+	} else {
+		span_loop_ssse3_lookup(&s, &slen, tables);
+	}
+	#include "../generic/span_tail.c"
+#else
+	BASE64_SPAN_STUB
+#endif
+}
+
+size_t base64_stream_decode_ignore_avx(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending)
+{
+#if BASE64_HAVE_AVX
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const uint8_t *s = (const uint8_t *) src;
+	uint8_t *o = (uint8_t *) out;
+	size_t slen = srclen;
+	size_t olen = 0;
+
+	// Lookup alphabets are left to the caller:
+	if (tables->dec_ranges) {
+		dec_loop_ssse3_ignore(&s, &slen, &o, &olen, tables, set, pending, npending);
+	}
+	*outlen = olen;
+	return srclen - slen;
+#else
+	BASE64_DEC_IGNORE_STUB
+#endif
+}
+
+size_t base64_stream_encode_wrap_avx(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen)
+{
+#if BASE64_HAVE_AVX
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const uint8_t *s = (const uint8_t *) src;
+	uint8_t *o = (uint8_t *) out;
+	size_t slen = srclen;
+	size_t olen = 0;
+
+	// Lookup alphabets are left to the caller:
+	if (tables->enc_ranges) {
+		enc_loop_ssse3_wrap(&s, &slen, &o, &olen, tables, state);
+	}
+	*outlen = olen;
+	return srclen - slen;
+#else
+	BASE64_ENC_WRAP_STUB
+#endif
+}
+
+#if BASE64_HAVE_AVX
+const struct base64_fixed base64_fixed_avx = BASE64_FIXED_SSSE3;
+#endif
@@ -1,25 +1,7 @@
 #pragma once
 static inline int
-dec_loop_avx2_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
+dec_loop_avx2_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const __m256i lut_lo, const __m256i lut_hi, const __m256i lut_roll, const __m256i limit)
 {
-	const __m256i lut_lo = _mm256_setr_epi8(
-		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
-		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
-
-	const __m256i lut_hi = _mm256_setr_epi8(
-		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
-		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
-		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
-
-	const __m256i lut_roll = _mm256_setr_epi8(
-		0,  16,  19,   4, -65, -65, -71, -71,
-		0,   0,   0,   0,   0,   0,   0,   0,
-		0,  16,  19,   4, -65, -65, -71, -71,
-		0,   0,   0,   0,   0,   0,   0,   0);
-
 	const __m256i mask_2F = _mm256_set1_epi8(0x2F);
 
 	// Load input:
@@ -35,8 +17,8 @@ dec_loop_avx2_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
 		return 0;
 	}
 
-	const __m256i eq_2F = _mm256_cmpeq_epi8(str, mask_2F);
-	const __m256i roll  = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+	const __m256i below = _mm256_cmpgt_epi8(limit, str);
+	const __m256i roll  = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(below, hi_nibbles));
 
 	// Now simply add the delta values to the input:
 	str = _mm256_add_epi8(str, roll);
@@ -55,7 +37,7 @@ dec_loop_avx2_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
 }
 
 static inline void
-dec_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+dec_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 45) {
 		return;
@@ -70,37 +52,43 @@ dec_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 32;	// 32 bytes consumed per round
 	*olen += rounds * 24;	// 24 bytes produced per round
 
+	// Load the lookup tables for the alphabet in use into both lanes:
+	const __m256i lut_lo   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_lo));
+	const __m256i lut_hi   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_hi));
+	const __m256i lut_roll = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_roll));
+	const __m256i limit    = _mm256_set1_epi8((char) tables->dec_roll_limit);
+
 	do {
 		if (rounds >= 8) {
-			if (dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds)) {
+			if (dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 4) {
-			if (dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds)) {
+			if (dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 2) {
-			if (dec_loop_avx2_inner(s, o, &rounds) &&
-			    dec_loop_avx2_inner(s, o, &rounds)) {
+			if (dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
-		dec_loop_avx2_inner(s, o, &rounds);
+		dec_loop_avx2_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit);
 		break;
 
 	} while (rounds > 0);
@@ -0,0 +1,195 @@
+#pragma once
+// The AVX2 loop that skips the bytes of an ignore set classifies and
+// translates 32 bytes at a time, see the SSSE3 helpers for the algorithm. A
+// block with bytes to skip is compacted into the staging buffer one half at a
+// time, and the staged values are reshuffled at full width.
+
+static inline uint32_t
+dec_ignore_keep_avx2 (const __m256i lo_nibbles, const __m256i hi_nibbles, const __m256i skip_lut)
+{
+	const __m256i bits = _mm256_setr_epi8(
+		1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i skip = _mm256_and_si256(_mm256_shuffle_epi8(skip_lut, lo_nibbles), _mm256_shuffle_epi8(bits, hi_nibbles));
+
+	return (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(skip, _mm256_setzero_si256()));
+}
+
+// Match the sequences in a block of 32 bytes, see dec_ignore_seqs_ssse3():
+static inline int
+dec_ignore_seqs_avx2 (const struct base64_ignore_set *set, const uint8_t *c, uint64_t *skip, uint64_t *carry)
+{
+	uint64_t starts = *skip, cover = *skip;
+	int i, j;
+
+	for (i = 0; i < set->nseqs; i++) {
+		uint64_t m = ~starts;
+
+		for (j = 0; j < set->seqlen[i]; j++) {
+			const __m256i str = _mm256_loadu_si256((const __m256i *) (c + j));
+
+			m &= (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(str, _mm256_set1_epi8((char) set->seq[i][j])));
+		}
+		starts |= m;
+
+		for (j = 0; j < set->seqlen[i]; j++) {
+			if (cover & (m << j)) {
+				return 0;
+			}
+			cover |= m << j;
+		}
+	}
+	*skip  = cover & 0xFFFFFFFF;
+	*carry = cover >> 32;
+	return 1;
+}
+
+// Reshuffle and store 32 values. The full store writes 8 bytes of scratch
+// past the 24 bytes of output, see dec_ignore_store_ssse3():
+static inline void
+dec_ignore_store_avx2 (uint8_t **o, const __m256i val, const size_t left)
+{
+	const __m256i str = dec_reshuffle_avx2(val);
+
+	if (left >= 32) {
+		_mm256_storeu_si256((__m256i *) *o, str);
+	}
+	else {
+		_mm_storeu_si128((__m128i *) *o, _mm256_castsi256_si128(str));
+		_mm_storel_epi64((__m128i *) (*o + 16), _mm256_extracti128_si256(str, 1));
+	}
+	*o += 24;
+}
+
+static BASE64_FORCE_INLINE void
+dec_loop_avx2_ignore_body (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending, const int seqs)
+{
+	const uint8_t *c = *s;
+	uint8_t *out = *o;
+	size_t len = *slen;
+	size_t npend = *npending;
+	uint8_t stage[256 + 32];
+	uint64_t carry = 0;
+	size_t i;
+
+	const int overlap = dec_ignore_overlap(tables, set);
+
+	// Load the lookup tables for the alphabet in use and the bitmap of the
+	// bytes to skip into both lanes:
+	const __m256i lut_lo   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_lo));
+	const __m256i lut_hi   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_hi));
+	const __m256i lut_roll = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_roll));
+	const __m256i limit    = _mm256_set1_epi8((char) tables->dec_roll_limit);
+	const __m256i skip_lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->skip_lut));
+	const __m256i mask_2F  = _mm256_set1_epi8(0x2F);
+
+	dec_ignore_load_pending(stage, pending, npend, tables);
+
+	while (len >= 32) {
+		const __m256i str = _mm256_loadu_si256((const __m256i *) c);
+
+		// Table lookups, see dec_loop_ssse3():
+		const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+		const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+		const __m256i hi         = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+		const __m256i lo         = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+		const uint32_t invalid   = (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256()));
+
+		// Translate to 6-bit values:
+		const __m256i below = _mm256_cmpgt_epi8(limit, str);
+		const __m256i val   = _mm256_add_epi8(str, _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(below, hi_nibbles)));
+
+		// See dec_loop_ssse3_ignore():
+		if (invalid != 0 || overlap || carry != 0) {
+			uint32_t keep = dec_ignore_keep_avx2(lo_nibbles, hi_nibbles, skip_lut);
+			uint64_t skip = carry, next = 0;
+
+			if (seqs) {
+				if (len < 32 + BASE64_IGNORE_SEQLEN - 1 || !dec_ignore_seqs_avx2(set, c, &skip, &next)) {
+					const __m256i seq_lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->seq_lut));
+					const uint64_t seq = (uint32_t) ~dec_ignore_keep_avx2(lo_nibbles, hi_nibbles, seq_lut) & ~carry;
+
+					if (!dec_ignore_seqs(set, c, len, seq, &skip, &next, 32)) {
+						break;
+					}
+				}
+				keep &= (uint32_t) ~skip;
+			}
+			if (invalid & keep) {
+				break;
+			}
+			carry = next;
+
+			// Compact only the halves with bytes to skip:
+			if ((keep & 0xFFFF) != 0xFFFF) {
+				npend += dec_ignore_compact_ssse3(stage + npend, _mm256_castsi256_si128(val), keep & 0xFFFF);
+			}
+			else {
+				_mm_storeu_si128((__m128i *) (stage + npend), _mm256_castsi256_si128(val));
+				npend += 16;
+			}
+			if ((keep >> 16) != 0xFFFF) {
+				npend += dec_ignore_compact_ssse3(stage + npend, _mm256_extracti128_si256(val, 1), keep >> 16);
+			}
+			else {
+				_mm_storeu_si128((__m128i *) (stage + npend), _mm256_extracti128_si256(val, 1));
+				npend += 16;
+			}
+		}
+		else {
+			_mm256_storeu_si256((__m256i *) (stage + npend), val);
+			npend += 32;
+		}
+
+		c   += 32;
+		len -= 32;
+
+		// Decode the staged values in runs of 256, and move the rest
+		// to the front, see dec_loop_ssse3_ignore():
+		if (npend >= 256) {
+			for (i = 0; i < 256; i += 32) {
+				dec_ignore_store_avx2(&out, _mm256_loadu_si256((const __m256i *) (stage + i)), len);
+			}
+			_mm256_storeu_si256((__m256i *) stage, _mm256_loadu_si256((const __m256i *) (stage + 256)));
+			npend -= 256;
+		}
+	}
+
+	// Consume the end of a sequence that ran into the next block:
+	if (carry != 0) {
+		i = base64_ctz64(~carry);
+		c   += i;
+		len -= i;
+	}
+
+	// Decode the remaining runs of 32:
+	for (i = 0; npend - i >= 32; i += 32) {
+		dec_ignore_store_avx2(&out, _mm256_loadu_si256((const __m256i *) (stage + i)), len);
+	}
+	dec_ignore_save_pending(pending, stage + i, npend - i, tables);
+	npend -= i;
+
+	*npending = npend;
+	*olen += (size_t) (out - *o);
+	*slen  = len;
+	*s     = c;
+	*o     = out;
+}
+
+// See dec_loop_ssse3_ignore():
+static BASE64_NOINLINE void
+dec_loop_avx2_ignore_seqs (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	dec_loop_avx2_ignore_body(s, slen, o, olen, tables, set, pending, npending, 1);
+}
+
+static inline void
+dec_loop_avx2_ignore (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	if (set->nseqs > 0) {
+		dec_loop_avx2_ignore_seqs(s, slen, o, olen, tables, set, pending, npending);
+	}
+	else {
+		dec_loop_avx2_ignore_body(s, slen, o, olen, tables, set, pending, npending, 0);
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+static inline __m256i
+dec_translate_lookup (const __m256i str, const __m256i *lut)
+{
+	// See the SSSE3 dec_translate_lookup() for an explanation. The rows
+	// are duplicated in both lanes:
+	const __m256i step = _mm256_set1_epi8(16);
+
+	__m256i indices = str;
+	__m256i out = _mm256_shuffle_epi8(lut[0], indices);
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[1], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[2], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[3], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[4], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[5], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[6], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	return _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[7], indices));
+}
+
+static inline int
+dec_loop_avx2_lookup_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const __m256i *lut)
+{
+	// Load input:
+	__m256i str = _mm256_loadu_si256((__m256i *) *s);
+
+	// Translate to 6-bit values:
+	const __m256i values = dec_translate_lookup(str, lut);
+
+	// Check for invalid input, see dec_loop_ssse3_lookup_inner():
+	if (_mm256_movemask_epi8(_mm256_or_si256(values, str)) != 0) {
+		return 0;
+	}
+
+	// Reshuffle the input to packed 12-byte output format:
+	str = dec_reshuffle_avx2(values);
+
+	// Store the output:
+	_mm256_storeu_si256((__m256i *) *o, str);
+
+	*s += 32;
+	*o += 24;
+	*rounds -= 1;
+
+	return 1;
+}
+
+// Decoder for alphabets that do not fit the range-based decoder:
+static inline void
+dec_loop_avx2_lookup (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	if (*slen < 45) {
+		return;
+	}
+
+	// Process blocks of 32 bytes per round, see dec_loop_avx2():
+	size_t rounds = (*slen - 13) / 32;
+
+	*slen -= rounds * 32;	// 32 bytes consumed per round
+	*olen += rounds * 24;	// 24 bytes produced per round
+
+	// Load the lookup table rows into both lanes:
+	const __m256i lut[8] = {
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 0)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 1)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 2)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 3)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 4)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 5)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 6)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 7)),
+	};
+
+	do {
+		if (rounds >= 8) {
+			if (dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 4) {
+			if (dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 2) {
+			if (dec_loop_avx2_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_avx2_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		dec_loop_avx2_lookup_inner(s, o, &rounds, lut);
+		break;
+
+	} while (rounds > 0);
+
+	// Adjust for any rounds that were skipped:
+	*slen += rounds * 32;
+	*olen -= rounds * 24;
+}
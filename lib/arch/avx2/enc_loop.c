@@ -1,5 +1,5 @@
 static inline void
-enc_loop_avx2_inner_first (const uint8_t **s, uint8_t **o)
+enc_loop_avx2_inner_first (const uint8_t **s, uint8_t **o, const __m256i lut)
 {
 	// First load is done at s - 0 to not get a segfault:
 	__m256i src = _mm256_loadu_si256((__m256i *) *s);
@@ -9,7 +9,7 @@ enc_loop_avx2_inner_first (const uint8_t **s, uint8_t **o)
 
 	// Reshuffle, translate, store:
 	src = enc_reshuffle(src);
-	src = enc_translate(src);
+	src = enc_translate(src, lut);
 	_mm256_storeu_si256((__m256i *) *o, src);
 
 	// Subsequent loads will be done at s - 4, set pointer for next round:
@@ -18,14 +18,14 @@ enc_loop_avx2_inner_first (const uint8_t **s, uint8_t **o)
 }
 
 static inline void
-enc_loop_avx2_inner (const uint8_t **s, uint8_t **o)
+enc_loop_avx2_inner (const uint8_t **s, uint8_t **o, const __m256i lut)
 {
 	// Load input:
 	__m256i src = _mm256_loadu_si256((__m256i *) *s);
 
 	// Reshuffle, translate, store:
 	src = enc_reshuffle(src);
-	src = enc_translate(src);
+	src = enc_translate(src, lut);
 	_mm256_storeu_si256((__m256i *) *o, src);
 
 	*s += 24;
@@ -33,7 +33,7 @@ enc_loop_avx2_inner (const uint8_t **s, uint8_t **o)
 }
 
 static inline void
-enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 32) {
 		return;
@@ -48,39 +48,42 @@ enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 24;   // 24 bytes consumed per round
 	*olen += rounds * 32;   // 32 bytes produced per round
 
+	// Load the translation table for the alphabet in use into both lanes:
+	const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut));
+
 	// The first loop iteration requires special handling to ensure that
 	// the read, which is done at an offset, does not underflow the buffer:
-	enc_loop_avx2_inner_first(s, o);
+	enc_loop_avx2_inner_first(s, o, lut);
 	rounds--;
 
 	while (rounds > 0) {
 		if (rounds >= 8) {
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_avx2_inner(s, o);
-			enc_loop_avx2_inner(s, o);
+			enc_loop_avx2_inner(s, o, lut);
+			enc_loop_avx2_inner(s, o, lut);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_avx2_inner(s, o);
+		enc_loop_avx2_inner(s, o, lut);
 		break;
 	}
 
@@ -120,7 +120,7 @@
 #pragma GCC diagnostic ignored "-Woverlength-strings"
 
 static inline void
-enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	// For a clearer explanation of the algorithm used by this function,
 	// please refer to the plain (not inline assembly) implementation. This
@@ -149,14 +149,12 @@ enc_loop_avx2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	// Number of rounds remaining after the 36x loop.
 	rounds %= 36;
 
-	// Lookup tables.
+	// Lookup tables. The second table depends on the alphabet in use.
 	const __m256i lut0 = _mm256_set_epi8(
 		10, 11,  9, 10,  7,  8,  6,  7,  4,  5,  3,  4,  1,  2,  0,  1,
 		14, 15, 13, 14, 11, 12, 10, 11,  8,  9,  7,  8,  5,  6,  4,  5);
 
-	const __m256i lut1 = _mm256_setr_epi8(
-		65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
-		65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+	const __m256i lut1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut));
 
 	// Temporary registers.
 	__m256i a, b, c, d, e;
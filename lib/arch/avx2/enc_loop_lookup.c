@@ -0,0 +1,115 @@
+static inline __m256i
+enc_translate_lookup (const __m256i in, const __m256i *lut)
+{
+	// See the SSSE3 enc_translate_lookup() for an explanation. The rows
+	// are duplicated in both lanes:
+	const __m256i step = _mm256_set1_epi8(16);
+
+	__m256i indices = in;
+	__m256i out = _mm256_shuffle_epi8(lut[0], indices);
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[1], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	out = _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[2], indices));
+
+	indices = _mm256_sub_epi8(indices, step);
+	return _mm256_xor_si256(out, _mm256_shuffle_epi8(lut[3], indices));
+}
+
+static inline void
+enc_loop_avx2_lookup_inner_first (const uint8_t **s, uint8_t **o, const __m256i *lut)
+{
+	// First load is done at s - 0 to not get a segfault:
+	__m256i src = _mm256_loadu_si256((__m256i *) *s);
+
+	// Shift by 4 bytes, as required by enc_reshuffle:
+	src = _mm256_permutevar8x32_epi32(src, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+
+	// Reshuffle, translate, store:
+	src = enc_reshuffle(src);
+	src = enc_translate_lookup(src, lut);
+	_mm256_storeu_si256((__m256i *) *o, src);
+
+	// Subsequent loads will be done at s - 4, set pointer for next round:
+	*s += 20;
+	*o += 32;
+}
+
+static inline void
+enc_loop_avx2_lookup_inner (const uint8_t **s, uint8_t **o, const __m256i *lut)
+{
+	// Load input:
+	__m256i src = _mm256_loadu_si256((__m256i *) *s);
+
+	// Reshuffle, translate, store:
+	src = enc_reshuffle(src);
+	src = enc_translate_lookup(src, lut);
+	_mm256_storeu_si256((__m256i *) *o, src);
+
+	*s += 24;
+	*o += 32;
+}
+
+// Encoder for alphabets that do not fit the range-based encoder:
+static inline void
+enc_loop_avx2_lookup (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	if (*slen < 32) {
+		return;
+	}
+
+	// Process blocks of 24 bytes at a time, see enc_loop_avx2():
+	size_t rounds = (*slen - 4) / 24;
+
+	*slen -= rounds * 24;   // 24 bytes consumed per round
+	*olen += rounds * 32;   // 32 bytes produced per round
+
+	// Load the lookup table rows into both lanes:
+	const __m256i lut[4] = {
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 0)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 1)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 2)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 3)),
+	};
+
+	// The first loop iteration requires special handling to ensure that
+	// the read, which is done at an offset, does not underflow the buffer:
+	enc_loop_avx2_lookup_inner_first(s, o, lut);
+	rounds--;
+
+	while (rounds > 0) {
+		if (rounds >= 8) {
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			rounds -= 8;
+			continue;
+		}
+		if (rounds >= 4) {
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			rounds -= 4;
+			continue;
+		}
+		if (rounds >= 2) {
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			enc_loop_avx2_lookup_inner(s, o, lut);
+			rounds -= 2;
+			continue;
+		}
+		enc_loop_avx2_lookup_inner(s, o, lut);
+		break;
+	}
+
+	// Add the offset back:
+	*s += 4;
+}
@@ -0,0 +1,61 @@
+// Encode with non-temporal stores, which write the output to memory without
+// reading its lines into the cache first, and prefetch the input ahead of the
+// loads. A block is 8 rounds: three cache lines of input, four of output.
+static inline void
+enc_loop_avx2_nt (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	// The stores must be aligned:
+	if (*slen < 32 || !enc_nt_align(s, slen, o, olen, tables, 32)) {
+		return;
+	}
+
+	// The first round is done on its own, after which the loads are done
+	// at an offset of -4. Ensure that there will be at least 4 remaining
+	// bytes after the last block, so that the final read will not pass
+	// beyond the bounds of the input buffer:
+	if (*slen < 4 + 24 + 192) {
+		return;
+	}
+	size_t blocks = (*slen - 4 - 24) / 192;
+
+	*slen -= 24 + blocks * 192;	// 192 bytes consumed per block
+	*olen += 32 + blocks * 256;	// 256 bytes produced per block
+
+	// Load the translation table for the alphabet in use into both lanes:
+	const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut));
+
+	// The first load is done at s - 0 to not get a segfault, and shifted by
+	// 4 bytes, as required by enc_reshuffle:
+	__m256i str = _mm256_loadu_si256((__m256i *) *s);
+
+	str = _mm256_permutevar8x32_epi32(str, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+	str = enc_reshuffle(str);
+	str = enc_translate(str, lut);
+	_mm256_stream_si256((__m256i *) *o, str);
+
+	*s += 20;
+	*o += 32;
+
+	for (; blocks > 0; blocks--) {
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH,       _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH +  64, _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH + 128, _MM_HINT_NTA);
+
+		for (int i = 0; i < 8; i++) {
+			str = _mm256_loadu_si256((__m256i *) *s);
+			str = enc_reshuffle(str);
+			str = enc_translate(str, lut);
+			_mm256_stream_si256((__m256i *) *o, str);
+
+			*s += 24;
+			*o += 32;
+		}
+	}
+
+	// Add the offset back:
+	*s += 4;
+
+	// Order the stores before those that follow, such as the release of
+	// the output to another thread:
+	_mm_sfence();
+}
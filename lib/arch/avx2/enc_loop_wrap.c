@@ -0,0 +1,67 @@
+// Store 32 characters, see enc_wrap_store_ssse3(). A block that holds a line
+// break is stored one half at a time:
+static inline void
+enc_wrap_store_avx2 (uint8_t **o, const __m256i str, size_t *col, const size_t wrap, const uint16_t eol, const size_t eollen)
+{
+	if (wrap - *col >= 32) {
+		_mm256_storeu_si256((__m256i *) *o, str);
+		*o   += 32;
+		*col += 32;
+		return;
+	}
+	enc_wrap_store_ssse3(o, _mm256_castsi256_si128(str), col, wrap, eol, eollen);
+	enc_wrap_store_ssse3(o, _mm256_extracti128_si256(str, 1), col, wrap, eol, eollen);
+}
+
+// Encode while breaking the lines of the output, see enc_wrap_store_ssse3():
+static inline void
+enc_loop_avx2_wrap (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, struct base64_state *state)
+{
+	if (*slen < 36) {
+		return;
+	}
+
+	// Process blocks of 24 bytes at a time. Blocks are loaded 32 bytes at
+	// a time at an offset of -4, see enc_loop_avx2(). Leave at least 12
+	// bytes of input after the last round, so that the final read will not
+	// pass beyond the bounds of the input buffer, and so that the caller
+	// stores at least 16 more characters over the scratch of the last
+	// store:
+	size_t rounds = (*slen - 12) / 24;
+
+	const size_t wrap = state->wrap;
+	size_t col = state->wrap_col;
+	uint8_t *out = *o;
+	uint16_t eol;
+	const size_t eollen = enc_wrap_eol(&eol, state->wrap_crlf);
+
+	*slen -= rounds * 24;	// 24 bytes consumed per round
+
+	// Load the translation table for the alphabet in use into both lanes:
+	const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut));
+
+	// The first load is done at s - 0, and shifted by 4 bytes:
+	__m256i str = _mm256_loadu_si256((const __m256i *) *s);
+
+	str = _mm256_permutevar8x32_epi32(str, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+	*s += 20;
+
+	for (;;) {
+		str = enc_reshuffle(str);
+		str = enc_translate(str, lut);
+		enc_wrap_store_avx2(&out, str, &col, wrap, eol, eollen);
+
+		if (--rounds == 0) {
+			break;
+		}
+		str = _mm256_loadu_si256((const __m256i *) *s);
+		*s += 24;
+	}
+
+	// Add the offset back:
+	*s += 4;
+
+	*olen += (size_t) (out - *o);
+	*o = out;
+	state->wrap_col = col;
+}
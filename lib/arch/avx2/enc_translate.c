@@ -1,10 +1,8 @@
 static inline __m256i
-enc_translate (const __m256i in)
+enc_translate (const __m256i in, const __m256i lut)
 {
-	// A lookup table containing the absolute offsets for all ranges:
-	const __m256i lut = _mm256_setr_epi8(
-		65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
-		65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+	// The lookup table `lut` contains the absolute offsets for all ranges,
+	// in both lanes. See the SSSE3 encoder for the values.
 
 	// Translate values 0..63 to the Base64 alphabet. There are five sets:
 	// #  From      To         Abs    Index  Characters
@@ -0,0 +1,387 @@
+// Fixed-width kernels for base64_encode_16() and friends. See the SSSE3
+// kernels: with 24 bytes to a round, each size takes one to three rounds. The
+// rounds are loaded in the layout that enc_reshuffle() expects, with bytes 4
+// to 15 of the low lane and 0 to 11 of the high lane holding the input.
+
+// Encode the input in `in`, in the layout above, to 32 characters:
+static inline __m256i
+enc_fixed_avx2 (const __m256i in, const __m256i lut)
+{
+	return enc_translate(enc_reshuffle(in), lut);
+}
+
+// Put the padding character in the lanes of `str` that are set in `mask`:
+static inline __m128i
+enc_fixed_pad_avx2 (const __m128i str, const __m128i mask, const struct base64_tables *tables)
+{
+	return _mm_blendv_epi8(str, _mm_set1_epi8((char) tables->pad), mask);
+}
+
+static inline int
+enc_fixed_padded_avx2 (int flags)
+{
+	return !(flags & (BASE64_NOPAD | BASE64_FORBID_PAD));
+}
+
+static inline __m256i
+enc_fixed_lut_avx2 (const struct base64_tables *tables)
+{
+	return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->enc_lut));
+}
+
+static void
+enc_fixed_avx2_16 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m256i lut = enc_fixed_lut_avx2(tables);
+
+	// Bytes 0..11 in the low lane, and 12..15 followed by zeros in the
+	// high lane:
+	const __m256i in = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) src)), _mm256_setr_epi8(
+		 0,  0,  0,  0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,
+		12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+
+	const __m256i str = enc_fixed_avx2(in, lut);
+	const __m128i lo  = _mm256_castsi256_si128(str);
+	const __m128i hi  = _mm256_extracti128_si256(str, 1);
+
+	_mm_storeu_si128((__m128i *) out, lo);
+
+	// Characters 16..23, of which the last two are padding:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i p = enc_fixed_pad_avx2(hi, _mm_setr_epi8(0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 8), _mm_alignr_epi8(p, lo, 8));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 6), _mm_alignr_epi8(hi, lo, 6));
+	}
+}
+
+static void
+enc_fixed_avx2_20 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m256i lut = enc_fixed_lut_avx2(tables);
+
+	// Bytes 0..11 in the low lane, and 12..19 from an overlapping load in
+	// the high lane:
+	const __m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(
+		_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) src)),
+		_mm_loadu_si128((const __m128i *) (src + 4)), 1), _mm256_setr_epi8(
+		 0,  0,  0,  0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,
+		 8,  9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1));
+
+	const __m256i str = enc_fixed_avx2(in, lut);
+	const __m128i lo  = _mm256_castsi256_si128(str);
+	const __m128i hi  = _mm256_extracti128_si256(str, 1);
+
+	_mm_storeu_si128((__m128i *) out, lo);
+
+	// Characters 16..27, of which the last one is padding:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i p = enc_fixed_pad_avx2(hi, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 12), _mm_alignr_epi8(p, lo, 12));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 11), _mm_alignr_epi8(hi, lo, 11));
+	}
+}
+
+static void
+enc_fixed_avx2_32 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m256i lut = enc_fixed_lut_avx2(tables);
+
+	// Bytes 0..23, moved into place as in the first round of
+	// enc_loop_avx2(), and 24..31 from an overlapping load:
+	const __m256i a = enc_fixed_avx2(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) src), _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6)), lut);
+	const __m256i b = enc_fixed_avx2(_mm256_shuffle_epi8(
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) (src + 16))), _mm256_setr_epi8(
+		 0,  0,  0,  0,  8,  9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)), lut);
+
+	const __m128i hi = _mm256_extracti128_si256(a, 1);
+	const __m128i c  = _mm256_castsi256_si128(b);
+
+	_mm256_storeu_si256((__m256i *) out, a);
+
+	// Characters 32..43, of which the last one is padding:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i p = enc_fixed_pad_avx2(c, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 28), _mm_alignr_epi8(p, hi, 12));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 27), _mm_alignr_epi8(c, hi, 11));
+	}
+}
+
+static void
+enc_fixed_avx2_48 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m256i lut = enc_fixed_lut_avx2(tables);
+
+	// Two whole rounds, the second from an overlapping load. There is no
+	// padding:
+	_mm256_storeu_si256((__m256i *) out, enc_fixed_avx2(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) src), _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6)), lut));
+	_mm256_storeu_si256((__m256i *) (out + 32), enc_fixed_avx2(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) (src + 16)), _mm256_setr_epi32(2, 2, 3, 4, 5, 6, 7, 7)), lut));
+}
+
+static void
+enc_fixed_avx2_64 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m256i lut = enc_fixed_lut_avx2(tables);
+
+	// Two whole rounds as above, and bytes 48..63 from an overlapping load,
+	// followed by zeros:
+	const __m256i c = enc_fixed_avx2(_mm256_and_si256(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) (src + 32)), _mm256_setr_epi32(4, 4, 5, 6, 7, 7, 7, 7)),
+		_mm256_setr_epi32(-1, -1, -1, -1, -1, 0, 0, 0)), lut);
+
+	const __m128i lo = _mm256_castsi256_si128(c);
+	const __m128i hi = _mm256_extracti128_si256(c, 1);
+
+	_mm256_storeu_si256((__m256i *) out, enc_fixed_avx2(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) src), _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6)), lut));
+	_mm256_storeu_si256((__m256i *) (out + 32), enc_fixed_avx2(_mm256_permutevar8x32_epi32(
+		_mm256_loadu_si256((const __m256i *) (src + 16)), _mm256_setr_epi32(2, 2, 3, 4, 5, 6, 7, 7)), lut));
+	_mm_storeu_si128((__m128i *) (out + 64), lo);
+
+	// Characters 80..87, of which the last two are padding:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i p = enc_fixed_pad_avx2(hi, _mm_setr_epi8(0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 72), _mm_alignr_epi8(p, lo, 8));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 70), _mm_alignr_epi8(hi, lo, 6));
+	}
+}
+
+// Translate 32 characters to their 6-bit values as dec_loop_avx2() does, and
+// flag the invalid ones with a nonzero byte in `bad`:
+static inline __m256i
+dec_fixed_translate_avx2 (const __m256i str, const struct base64_tables *tables, __m256i *bad)
+{
+	const __m256i lut_lo   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_lo));
+	const __m256i lut_hi   = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_hi));
+	const __m256i lut_roll = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_roll));
+	const __m256i limit    = _mm256_set1_epi8((char) tables->dec_roll_limit);
+	const __m256i mask_2F  = _mm256_set1_epi8(0x2F);
+
+	const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+	const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+	const __m256i hi         = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+	const __m256i lo         = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+	*bad = _mm256_or_si256(*bad, _mm256_and_si256(lo, hi));
+
+	const __m256i below = _mm256_cmpgt_epi8(limit, str);
+	const __m256i roll  = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(below, hi_nibbles));
+
+	return _mm256_add_epi8(str, roll);
+}
+
+// Shuffle the last characters of the input into place with `ctrl`, filling the
+// lanes that it clears with the character for zero. See the SSSE3 kernels:
+static inline __m128i
+dec_fixed_tail_avx2 (const __m128i str, const __m128i ctrl, const struct base64_tables *tables)
+{
+	const __m128i fill = _mm_and_si128(_mm_cmplt_epi8(ctrl, _mm_setzero_si128()), _mm_set1_epi8((char) tables->enc_6bit[0]));
+
+	return _mm_or_si128(_mm_shuffle_epi8(str, ctrl), fill);
+}
+
+// Flag the lanes of `str` that are set in `mask` but do not hold the padding
+// character:
+static inline __m256i
+dec_fixed_pads_avx2 (const __m128i str, const __m128i mask, const struct base64_tables *tables)
+{
+	return _mm256_castsi128_si256(_mm_and_si128(_mm_xor_si128(str, _mm_set1_epi8((char) tables->pad)), mask));
+}
+
+// Under BASE64_STRICT, flag the unused bits of the last character, whose lane
+// in the values of the tail is set to `mask`:
+static inline __m256i
+dec_fixed_strict_avx2 (const __m256i values, const __m256i mask, int flags)
+{
+	return (flags & BASE64_STRICT) ? _mm256_and_si256(values, mask) : _mm256_setzero_si256();
+}
+
+// Join two 128-bit halves into a vector of 32 characters:
+static inline __m256i
+dec_fixed_join_avx2 (const __m128i lo, const __m128i hi)
+{
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static int
+dec_fixed_avx2_16 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m256i bad = _mm256_setzero_si256();
+	__m128i tail;
+
+	// Characters 16..21, and two pads unless disabled:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 8));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(8, 9, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+		bad  = dec_fixed_pads_avx2(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 6));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m256i a = dec_fixed_translate_avx2(dec_fixed_join_avx2(_mm_loadu_si128((const __m128i *) src), tail), tables, &bad);
+	bad = _mm256_or_si256(bad, dec_fixed_strict_avx2(a, _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0x0F, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), flags));
+
+	if (!_mm256_testz_si256(bad, bad)) {
+		return 0;
+	}
+	_mm_storeu_si128((__m128i *) out, _mm256_castsi256_si128(dec_reshuffle_avx2(a)));
+	return 1;
+}
+
+static int
+dec_fixed_avx2_20 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m256i bad = _mm256_setzero_si256();
+	__m128i tail;
+
+	// Characters 16..26, and a pad unless disabled:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 12));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -1, -1, -1, -1, -1), tables);
+		bad  = dec_fixed_pads_avx2(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 11));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m256i a = dec_fixed_translate_avx2(dec_fixed_join_avx2(_mm_loadu_si128((const __m128i *) src), tail), tables, &bad);
+	bad = _mm256_or_si256(bad, dec_fixed_strict_avx2(a, _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,    0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03, 0, 0, 0, 0, 0), flags));
+
+	if (!_mm256_testz_si256(bad, bad)) {
+		return 0;
+	}
+
+	// Bytes 0..15 and 4..19 of the packed output:
+	const __m256i d  = dec_reshuffle_avx2(a);
+	const __m128i lo = _mm256_castsi256_si128(d);
+
+	_mm_storeu_si128((__m128i *) out, lo);
+	_mm_storeu_si128((__m128i *) (out + 4), _mm_alignr_epi8(_mm256_extracti128_si256(d, 1), lo, 4));
+	return 1;
+}
+
+static int
+dec_fixed_avx2_32 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m256i bad = _mm256_setzero_si256();
+	__m128i tail;
+
+	// Characters 32..42, and a pad unless disabled:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 28));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -1, -1, -1, -1, -1), tables);
+		bad  = dec_fixed_pads_avx2(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 27));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1), tables);
+	}
+
+	// The tail goes in both lanes, so that the high one holds valid input:
+	const __m256i a = dec_fixed_translate_avx2(_mm256_loadu_si256((const __m256i *) src), tables, &bad);
+	const __m256i b = dec_fixed_translate_avx2(_mm256_broadcastsi128_si256(tail), tables, &bad);
+	bad = _mm256_or_si256(bad, dec_fixed_strict_avx2(b, _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,    0, 0, 0, 0, 0), flags));
+
+	if (!_mm256_testz_si256(bad, bad)) {
+		return 0;
+	}
+
+	// Bytes 0..23, whose high lane ends in zeros, and 24..31:
+	const __m256i da = dec_reshuffle_avx2(a);
+	const __m128i db = _mm256_castsi256_si128(dec_reshuffle_avx2(b));
+
+	_mm_storeu_si128((__m128i *) out, _mm256_castsi256_si128(da));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm256_extracti128_si256(da, 1), _mm_slli_si128(db, 8)));
+	return 1;
+}
+
+static int
+dec_fixed_avx2_48 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m256i bad = _mm256_setzero_si256();
+
+	// Two whole rounds, without padding:
+	const __m256i a = dec_fixed_translate_avx2(_mm256_loadu_si256((const __m256i *) src), tables, &bad);
+	const __m256i b = dec_fixed_translate_avx2(_mm256_loadu_si256((const __m256i *) (src + 32)), tables, &bad);
+
+	if (!_mm256_testz_si256(bad, bad)) {
+		return 0;
+	}
+
+	// Pack the two 24-byte results into three vectors:
+	const __m256i da = dec_reshuffle_avx2(a);
+	const __m256i db = dec_reshuffle_avx2(b);
+	const __m128i lo = _mm256_castsi256_si128(db);
+
+	_mm_storeu_si128((__m128i *) out, _mm256_castsi256_si128(da));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm256_extracti128_si256(da, 1), _mm_slli_si128(lo, 8)));
+	_mm_storeu_si128((__m128i *) (out + 32), _mm_alignr_epi8(_mm256_extracti128_si256(db, 1), lo, 8));
+	return 1;
+}
+
+static int
+dec_fixed_avx2_64 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m256i bad = _mm256_setzero_si256();
+	__m128i tail;
+
+	// Characters 80..85, and two pads unless disabled:
+	if (enc_fixed_padded_avx2(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 72));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(8, 9, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+		bad  = dec_fixed_pads_avx2(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 70));
+		tail = dec_fixed_tail_avx2(str, _mm_setr_epi8(10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m256i a = dec_fixed_translate_avx2(_mm256_loadu_si256((const __m256i *) src), tables, &bad);
+	const __m256i b = dec_fixed_translate_avx2(_mm256_loadu_si256((const __m256i *) (src + 32)), tables, &bad);
+	const __m256i c = dec_fixed_translate_avx2(dec_fixed_join_avx2(_mm_loadu_si128((const __m128i *) (src + 64)), tail), tables, &bad);
+	bad = _mm256_or_si256(bad, dec_fixed_strict_avx2(c, _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0x0F, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), flags));
+
+	if (!_mm256_testz_si256(bad, bad)) {
+		return 0;
+	}
+
+	// Pack the results as for 48 bytes, followed by bytes 48..63:
+	const __m256i da = dec_reshuffle_avx2(a);
+	const __m256i db = dec_reshuffle_avx2(b);
+	const __m128i lo = _mm256_castsi256_si128(db);
+
+	_mm_storeu_si128((__m128i *) out, _mm256_castsi256_si128(da));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm256_extracti128_si256(da, 1), _mm_slli_si128(lo, 8)));
+	_mm_storeu_si128((__m128i *) (out + 32), _mm_alignr_epi8(_mm256_extracti128_si256(db, 1), lo, 8));
+	_mm_storeu_si128((__m128i *) (out + 48), _mm256_castsi256_si128(dec_reshuffle_avx2(c)));
+	return 1;
+}
+
+// The table entry of the codecs that build these kernels:
+#define BASE64_FIXED_AVX2 \
+	{ { enc_fixed_avx2_16, enc_fixed_avx2_20, enc_fixed_avx2_32, enc_fixed_avx2_48, enc_fixed_avx2_64 } \
+	, { dec_fixed_avx2_16, dec_fixed_avx2_20, dec_fixed_avx2_32, dec_fixed_avx2_48, dec_fixed_avx2_64 } }
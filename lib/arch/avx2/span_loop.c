@@ -0,0 +1,103 @@
+#pragma once
+// See the SSSE3 span loops for an explanation. Four blocks of 32 bytes are
+// checked per round.
+
+static inline __m256i
+span_classify_avx2 (const __m256i str, const __m256i lut_lo, const __m256i lut_hi)
+{
+	const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+
+	// Table lookups, see dec_loop_avx2():
+	const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+	const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+	const __m256i hi         = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+	const __m256i lo         = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+	return _mm256_and_si256(lo, hi);
+}
+
+static inline void
+span_loop_avx2 (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the lookup tables for the alphabet in use into both lanes:
+	const __m256i lut_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_lo));
+	const __m256i lut_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_hi));
+
+	while (*slen >= 128) {
+		const __m256i a = span_classify_avx2(_mm256_loadu_si256((const __m256i *) (*s +  0)), lut_lo, lut_hi);
+		const __m256i b = span_classify_avx2(_mm256_loadu_si256((const __m256i *) (*s + 32)), lut_lo, lut_hi);
+		const __m256i c = span_classify_avx2(_mm256_loadu_si256((const __m256i *) (*s + 64)), lut_lo, lut_hi);
+		const __m256i d = span_classify_avx2(_mm256_loadu_si256((const __m256i *) (*s + 96)), lut_lo, lut_hi);
+
+		const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+
+		if (!_mm256_testz_si256(any, any)) {
+			break;
+		}
+		*s    += 128;
+		*slen -= 128;
+	}
+
+	while (*slen >= 32) {
+		const __m256i bad = span_classify_avx2(_mm256_loadu_si256((const __m256i *) *s), lut_lo, lut_hi);
+
+		// Flag the bytes with a nonzero "and" value:
+		const uint32_t mask = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(bad, _mm256_setzero_si256()));
+
+		if (mask != 0) {
+			*s    += base64_ctz32(mask);
+			*slen -= base64_ctz32(mask);
+			return;
+		}
+		*s    += 32;
+		*slen -= 32;
+	}
+}
+
+static inline __m256i
+span_classify_avx2_lookup (const __m256i str, const __m256i *lut)
+{
+	// See span_classify_ssse3_lookup():
+	return _mm256_or_si256(dec_translate_lookup(str, lut), str);
+}
+
+static inline void
+span_loop_avx2_lookup (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the lookup table rows into both lanes:
+	const __m256i lut[8] = {
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 0)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 1)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 2)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 3)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 4)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 5)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 6)),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 7)),
+	};
+
+	while (*slen >= 128) {
+		const __m256i a = span_classify_avx2_lookup(_mm256_loadu_si256((const __m256i *) (*s +  0)), lut);
+		const __m256i b = span_classify_avx2_lookup(_mm256_loadu_si256((const __m256i *) (*s + 32)), lut);
+		const __m256i c = span_classify_avx2_lookup(_mm256_loadu_si256((const __m256i *) (*s + 64)), lut);
+		const __m256i d = span_classify_avx2_lookup(_mm256_loadu_si256((const __m256i *) (*s + 96)), lut);
+
+		if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d))) != 0) {
+			break;
+		}
+		*s    += 128;
+		*slen -= 128;
+	}
+
+	while (*slen >= 32) {
+		const uint32_t mask = (uint32_t) _mm256_movemask_epi8(span_classify_avx2_lookup(_mm256_loadu_si256((const __m256i *) *s), lut));
+
+		if (mask != 0) {
+			*s    += base64_ctz32(mask);
+			*slen -= base64_ctz32(mask);
+			return;
+		}
+		*s    += 32;
+		*slen -= 32;
+	}
+}
@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../../../include/libbase64.h"
 #include "../../tables/tables.h"
@@ -10,10 +11,24 @@
 #if BASE64_HAVE_AVX512
 #include <immintrin.h>
 
-#include "../avx2/dec_reshuffle.c"
-#include "../avx2/dec_loop.c"
+#include "dec_reshuffle_translate.c"
+#include "dec_loop.c"
+#include "../ssse3/dec_reshuffle.c"
+#include "../ssse3/dec_loop_ignore.c"
+#include "dec_loop_ignore.c"
+#include "span_loop.c"
+#include "../generic/enc_nt.c"
 #include "enc_reshuffle_translate.c"
+#include "enc_loop_nt.c"
 #include "enc_loop.c"
+#include "../ssse3/enc_wrap.c"
+#include "enc_loop_wrap.c"
+
+// The fixed-width kernels of the AVX2 codec:
+#include "../avx2/enc_reshuffle.c"
+#include "../avx2/enc_translate.c"
+#include "../avx2/dec_reshuffle.c"
+#include "../avx2/fixed.c"
 
 #endif	// BASE64_HAVE_AVX512
 
@@ -21,21 +36,94 @@ void base64_stream_encode_avx512(struct base64_state *state, const char *src, si
 {
 #if BASE64_HAVE_AVX512
 	#include "../generic/enc_head.c"
-	enc_loop_avx512(&s, &slen, &o, &olen);
+	if (base64_enc_nontemporal(state->flags, slen)) {
+		enc_loop_avx512_nt(&s, &slen, &o, &olen, tables);
+	}
+	enc_loop_avx512(&s, &slen, &o, &olen, tables);
 	#include "../generic/enc_tail.c"
 #else
 	BASE64_ENC_STUB
 #endif
 }
 
-// Reuse AVX2 decoding. Not supporting AVX512 at present
 int	base64_stream_decode_avx512(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen)
 {
 #if BASE64_HAVE_AVX512
 	#include "../generic/dec_head.c"
-	dec_loop_avx2(&s, &slen, &o, &olen);
+	dec_loop_avx512(&s, &slen, &o, &olen, tables);
 	#include "../generic/dec_tail.c"
 #else
 	BASE64_DEC_STUB
 #endif
 }
+
+size_t base64_stream_span_avx512(const struct base64_state *state, const char *src, size_t srclen)
+{
+#if BASE64_HAVE_AVX512
+	#include "../generic/span_head.c"
+	span_loop_avx512(&s, &slen, tables);
+	#include "../generic/span_tail.c"
+#else
+	BASE64_SPAN_STUB
+#endif
+}
+
+size_t base64_stream_decode_ignore_avx512(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending)
+{
+#if BASE64_HAVE_AVX512
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const uint8_t *s = (const uint8_t *) src;
+	uint8_t *o = (uint8_t *) out;
+	size_t slen = srclen;
+	size_t olen = 0;
+
+	dec_loop_avx512_ignore(&s, &slen, &o, &olen, tables, set, pending, npending);
+	*outlen = olen;
+	return srclen - slen;
+#else
+	BASE64_DEC_IGNORE_STUB
+#endif
+}
+
+// The same, compacting with vpcompressb on CPUs with AVX512-VBMI2:
+size_t base64_stream_decode_ignore_avx512_vbmi2(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending)
+{
+#if BASE64_HAVE_AVX512
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const uint8_t *s = (const uint8_t *) src;
+	uint8_t *o = (uint8_t *) out;
+	size_t slen = srclen;
+	size_t olen = 0;
+
+#ifdef BASE64_VBMI2_TARGET
+	dec_loop_avx512_ignore_vbmi2(&s, &slen, &o, &olen, tables, set, pending, npending);
+#else
+	dec_loop_avx512_ignore(&s, &slen, &o, &olen, tables, set, pending, npending);
+#endif
+	*outlen = olen;
+	return srclen - slen;
+#else
+	BASE64_DEC_IGNORE_STUB
+#endif
+}
+
+size_t base64_stream_encode_wrap_avx512(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen)
+{
+#if BASE64_HAVE_AVX512
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const uint8_t *s = (const uint8_t *) src;
+	uint8_t *o = (uint8_t *) out;
+	size_t slen = srclen;
+	size_t olen = 0;
+
+	enc_loop_avx512_wrap(&s, &slen, &o, &olen, tables, state);
+	*outlen = olen;
+	return srclen - slen;
+#else
+	BASE64_ENC_WRAP_STUB
+#endif
+}
+
+#if BASE64_HAVE_AVX512
+const struct base64_fixed base64_fixed_avx512 = BASE64_FIXED_AVX2;
+#endif
@@ -0,0 +1,149 @@
+static inline int
+dec_loop_avx512_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const __m512i lookup_0, const __m512i lookup_1)
+{
+	__mmask64 invalid;
+
+	// Load input:
+	__m512i str = _mm512_loadu_si512((__m512i *) *s);
+
+	// Translate to 6-bit values:
+	str = dec_translate(str, lookup_0, lookup_1, &invalid);
+
+	// Check for invalid input: if any of the bytes was flagged, fall back
+	// on bytewise code to do error checking and reporting:
+	if (invalid != 0) {
+		return 0;
+	}
+
+	// Reshuffle the input to packed 48-byte output format:
+	str = dec_reshuffle(str);
+
+	// Store the output:
+	_mm512_storeu_si512((__m512i *) *o, str);
+
+	*s += 64;
+	*o += 48;
+	*rounds -= 1;
+
+	return 1;
+}
+
+static inline int
+dec_loop_avx512_masked (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const __m512i lookup_0, const __m512i lookup_1, const uint8_t *dec_8bit)
+{
+	// Process the remaining whole 4-byte groups, at most 64 bytes at a
+	// time. Masked-out bytes are neither loaded nor stored, so the final
+	// partial block never reads or writes beyond the bounds of the buffers.
+	while (*slen >= 4) {
+		size_t groups = (*slen >= 64) ? 16 : *slen / 4;
+
+		// If this round reaches the end of the input, leave a final
+		// group with end-of-string markers to the bytewise tail:
+		if (groups * 4 == *slen && dec_8bit[(*s)[*slen - 1]] == 254) {
+			if (--groups == 0) {
+				break;
+			}
+		}
+
+		const __mmask64 mask_src = ~UINT64_C(0) >> (64 - groups * 4);
+		const __mmask64 mask_dst = ~UINT64_C(0) >> (64 - groups * 3);
+		__mmask64 invalid;
+
+		// Load input, zeroing the masked-out bytes:
+		__m512i str = _mm512_maskz_loadu_epi8(mask_src, *s);
+
+		// Translate to 6-bit values:
+		str = dec_translate(str, lookup_0, lookup_1, &invalid);
+
+		// Check for invalid input in the loaded bytes. The zeroed
+		// bytes always translate to invalid values, so mask them out:
+		if (invalid & mask_src) {
+			return 0;
+		}
+
+		// Reshuffle and store the valid output bytes:
+		str = dec_reshuffle(str);
+		_mm512_mask_storeu_epi8(*o, mask_dst, str);
+
+		*s    += groups * 4;
+		*o    += groups * 3;
+		*slen -= groups * 4;
+		*olen += groups * 3;
+	}
+
+	return 1;
+}
+
+static inline int
+dec_loop_avx512_full (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const __m512i lookup_0, const __m512i lookup_1)
+{
+	if (*slen < 88) {
+		return 1;
+	}
+
+	// Process blocks of 64 bytes per round. Because 16 extra bytes are
+	// written after the output, ensure that there will be at least 24
+	// bytes of input data left to cover the gap. (22 data bytes and up to
+	// two end-of-string markers.)
+	size_t rounds = (*slen - 24) / 64;
+
+	*slen -= rounds * 64;	// 64 bytes consumed per round
+	*olen += rounds * 48;	// 48 bytes produced per round
+
+	do {
+		if (rounds >= 8) {
+			if (dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 4) {
+			if (dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 2) {
+			if (dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1) &&
+			    dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1)) {
+				continue;
+			}
+			break;
+		}
+		dec_loop_avx512_inner(s, o, &rounds, lookup_0, lookup_1);
+		break;
+
+	} while (rounds > 0);
+
+	// Adjust for any rounds that were skipped:
+	*slen += rounds * 64;
+	*olen -= rounds * 48;
+
+	return rounds == 0;
+}
+
+static inline void
+dec_loop_avx512 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	// Load the decoding table, the first 128 entries of the bytewise
+	// decoding table split into two 64-byte halves:
+	const __m512i lookup_0 = _mm512_loadu_si512(tables->dec_8bit);
+	const __m512i lookup_1 = _mm512_loadu_si512(tables->dec_8bit + 64);
+
+	// Decode the bulk of the input with full-width rounds, then finish the
+	// remainder with masked rounds. Stop at the first invalid input and
+	// let the bytewise tail do error checking and reporting:
+	if (dec_loop_avx512_full(s, slen, o, olen, lookup_0, lookup_1)) {
+		dec_loop_avx512_masked(s, slen, o, olen, lookup_0, lookup_1, tables->dec_8bit);
+	}
+}
@@ -0,0 +1,257 @@
+// The AVX512 loop that skips the bytes of an ignore set translates 64 bytes at
+// a time with the 128-byte lookup of the decoder, which flags the bytes outside
+// the alphabet. If there are any, a second 128-byte lookup in the table of the
+// set flags the bytes to skip, and the sequences are matched as in the SSSE3
+// helpers. The block is then compacted into the staging buffer, with
+// vpcompressb on CPUs with AVX512-VBMI2, and with vpermb otherwise.
+
+// The mask of the first `n` lanes:
+static inline __mmask64
+dec_ignore_first (const size_t n)
+{
+	return (n >= 64) ? ~UINT64_C(0) : (UINT64_C(1) << n) - 1;
+}
+
+static const uint8_t dec_ignore_lanes[64] = {
+	 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+};
+
+// Match the sequences in a block of 64 bytes, see dec_ignore_seqs_ssse3(). The
+// lanes that the matches cover past the block are shifted out of the mask, and
+// collected separately. Matches overlap if they cover fewer lanes than their
+// lengths add up to:
+static inline int
+dec_ignore_seqs_avx512 (const struct base64_ignore_set *set, const uint8_t *c, uint64_t *skip, uint64_t *carry)
+{
+	uint64_t starts = *skip, cover = 0, past = 0;
+	unsigned int n = 0;
+	int i, j;
+
+	for (i = 0; i < set->nseqs; i++) {
+		uint64_t m = ~starts;
+
+		for (j = 0; j < set->seqlen[i]; j++) {
+			m &= _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(c + j), _mm512_set1_epi8((char) set->seq[i][j]));
+		}
+		starts |= m;
+		n     += base64_popcount64(m) * set->seqlen[i];
+		cover |= m;
+
+		for (j = 1; j < set->seqlen[i]; j++) {
+			cover |= m << j;
+			past  |= m >> (64 - j);
+		}
+	}
+	if (base64_popcount64(cover) + base64_popcount64(past) != n) {
+		return 0;
+	}
+	*skip |= cover;
+	*carry = past;
+	return 1;
+}
+
+// Store the lanes not in `skip` to `dst`, in order, and return their number.
+// The indices of vpermb start out as the identity, and each skipped byte bumps
+// those of the lanes from its position on, less the bytes skipped before it.
+// The first two skipped bytes, such as a CRLF, are handled without branches:
+static inline size_t
+dec_ignore_compact_avx512 (uint8_t *dst, const __m512i val, const __m512i lanes, uint64_t skip)
+{
+	const __m512i one = _mm512_set1_epi8(1);
+	__m512i idx = lanes;
+	uint64_t bit;
+	size_t skipped;
+
+	bit   = skip & (0 - skip);
+	idx   = _mm512_mask_add_epi8(idx, 0 - bit, idx, one);
+	skip ^= bit;
+	skipped = (bit != 0);
+
+	bit   = skip & (0 - skip);
+	idx   = _mm512_mask_add_epi8(idx, 0 - (bit >> 1), idx, one);
+	skip ^= bit;
+	skipped += (bit != 0);
+
+	while (skip != 0) {
+		const unsigned int pos = base64_ctz64(skip);
+
+		idx   = _mm512_mask_add_epi8(idx, ~UINT64_C(0) << (pos - skipped), idx, one);
+		skip &= skip - 1;
+		skipped++;
+	}
+
+	_mm512_storeu_si512(dst, _mm512_permutexvar_epi8(idx, val));
+	return 64 - skipped;
+}
+
+#ifdef BASE64_VBMI2_TARGET
+// Store the lanes in `keep` to `dst`, in order, and return their number:
+BASE64_VBMI2_TARGET static inline size_t
+dec_ignore_compress_vbmi2 (uint8_t *dst, const __m512i val, const uint64_t keep)
+{
+	_mm512_storeu_si512(dst, _mm512_maskz_compress_epi8(keep, val));
+	return base64_popcount64(keep);
+}
+#endif
+
+// Reshuffle and store 64 values. The full store writes 16 bytes of scratch
+// past the 48 bytes of output, see dec_ignore_store_ssse3(), so store exactly
+// the output unless 64 more bytes of input follow:
+static inline void
+dec_ignore_store_avx512 (uint8_t **o, const __m512i val, const size_t left)
+{
+	if (left >= 64) {
+		_mm512_storeu_si512(*o, dec_reshuffle(val));
+	}
+	else {
+		_mm512_mask_storeu_epi8(*o, dec_ignore_first(48), dec_reshuffle(val));
+	}
+	*o += 48;
+}
+
+static BASE64_FORCE_INLINE void
+dec_loop_avx512_ignore_body (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending, const int vbmi2, const int seqs)
+{
+	const uint8_t *c = *s;
+	uint8_t *out = *o;
+	size_t len = *slen;
+	size_t npend = *npending;
+	uint8_t stage[256 + 64];
+	uint64_t carry = 0;
+	size_t i;
+
+	const int overlap = dec_ignore_overlap(tables, set);
+
+	// Load the decoding table and the table of the set, the first 128
+	// entries of each split into two 64-byte halves:
+	const __m512i lookup_0 = _mm512_loadu_si512(tables->dec_8bit);
+	const __m512i lookup_1 = _mm512_loadu_si512(tables->dec_8bit + 64);
+	const __m512i ignore_0 = _mm512_loadu_si512(set->table);
+	const __m512i ignore_1 = _mm512_loadu_si512(set->table + 64);
+	const __m512i flag     = _mm512_set1_epi8(BASE64_IGNORE_BYTE);
+	const __m512i flag_seq = _mm512_set1_epi8(BASE64_IGNORE_SEQ);
+	const __m512i lanes    = _mm512_loadu_si512(dec_ignore_lanes);
+
+	dec_ignore_load_pending(stage, pending, npend, tables);
+
+	while (len >= 64) {
+		const __m512i str = _mm512_loadu_si512((const __m512i *) c);
+		__mmask64 invalid;
+
+		// Translate to 6-bit values:
+		const __m512i val = dec_translate(str, lookup_0, lookup_1, &invalid);
+
+		// Only blocks with bytes outside the alphabet can hold bytes
+		// to skip, unless they overlap or a sequence runs into them.
+		// Bytes above 127 are never skipped, since the lookup ignores
+		// their eighth bit:
+		if (invalid != 0 || overlap || carry != 0) {
+			const __mmask64 low = ~_mm512_movepi8_mask(str);
+			const __m512i entry = _mm512_permutex2var_epi8(ignore_0, str, ignore_1);
+			uint64_t skip = carry, next = 0;
+
+			// See dec_loop_ssse3_ignore():
+			if (seqs) {
+				if (len < 64 + BASE64_IGNORE_SEQLEN - 1 || !dec_ignore_seqs_avx512(set, c, &skip, &next)) {
+					const uint64_t seq = _mm512_mask_test_epi8_mask(low, entry, flag_seq) & ~carry;
+
+					if (!dec_ignore_seqs(set, c, len, seq, &skip, &next, 64)) {
+						break;
+					}
+				}
+			}
+			skip |= _mm512_mask_test_epi8_mask(low, entry, flag);
+			if (invalid & ~skip) {
+				break;
+			}
+			carry = next;
+
+			if (vbmi2) {
+#ifdef BASE64_VBMI2_TARGET
+				npend += dec_ignore_compress_vbmi2(stage + npend, val, ~skip);
+#endif
+			}
+			else {
+				npend += dec_ignore_compact_avx512(stage + npend, val, lanes, skip);
+			}
+		}
+		else {
+			_mm512_storeu_si512(stage + npend, val);
+			npend += 64;
+		}
+
+		c   += 64;
+		len -= 64;
+
+		// Decode the staged values in runs of 256, and move the rest
+		// to the front, see dec_loop_ssse3_ignore():
+		if (npend >= 256) {
+			for (i = 0; i < 256; i += 64) {
+				dec_ignore_store_avx512(&out, _mm512_loadu_si512(stage + i), len);
+			}
+			_mm512_storeu_si512(stage, _mm512_loadu_si512(stage + 256));
+			npend -= 256;
+		}
+	}
+
+	// Consume the end of a sequence that ran into the next block:
+	if (carry != 0) {
+		i = base64_ctz64(~carry);
+		c   += i;
+		len -= i;
+	}
+
+	// Decode the remaining runs of 64:
+	for (i = 0; npend - i >= 64; i += 64) {
+		dec_ignore_store_avx512(&out, _mm512_loadu_si512(stage + i), len);
+	}
+	dec_ignore_save_pending(pending, stage + i, npend - i, tables);
+	npend -= i;
+
+	*npending = npend;
+	*olen += (size_t) (out - *o);
+	*slen  = len;
+	*s     = c;
+	*o     = out;
+}
+
+// See dec_loop_ssse3_ignore():
+static BASE64_NOINLINE void
+dec_loop_avx512_ignore_seqs (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	dec_loop_avx512_ignore_body(s, slen, o, olen, tables, set, pending, npending, 0, 1);
+}
+
+static inline void
+dec_loop_avx512_ignore (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	if (set->nseqs > 0) {
+		dec_loop_avx512_ignore_seqs(s, slen, o, olen, tables, set, pending, npending);
+	}
+	else {
+		dec_loop_avx512_ignore_body(s, slen, o, olen, tables, set, pending, npending, 0, 0);
+	}
+}
+
+#ifdef BASE64_VBMI2_TARGET
+// The same loops, compiled for AVX512-VBMI2:
+BASE64_VBMI2_TARGET static BASE64_NOINLINE void
+dec_loop_avx512_ignore_seqs_vbmi2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	dec_loop_avx512_ignore_body(s, slen, o, olen, tables, set, pending, npending, 1, 1);
+}
+
+BASE64_VBMI2_TARGET static void
+dec_loop_avx512_ignore_vbmi2 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	if (set->nseqs > 0) {
+		dec_loop_avx512_ignore_seqs_vbmi2(s, slen, o, olen, tables, set, pending, npending);
+	}
+	else {
+		dec_loop_avx512_ignore_body(s, slen, o, olen, tables, set, pending, npending, 1, 0);
+	}
+}
+#endif
@@ -0,0 +1,53 @@
+// AVX512 algorithm is based on permutevar and multiply-add. The code is based
+// on https://github.com/WojciechMula/base64simd which is under BSD-2 license.
+
+static inline __m512i
+dec_translate (const __m512i input, const __m512i lookup_0, const __m512i lookup_1, __mmask64 *invalid)
+{
+	// Translate ASCII to 6-bit values with a 128-byte lookup. The seventh
+	// bit of each input byte selects between the two 64-byte halves of the
+	// table, the eighth bit is ignored. Invalid characters (and '=') map to
+	// values with the high bit set:
+	const __m512i translated = _mm512_permutex2var_epi8(lookup_0, input, lookup_1);
+
+	// Because the eighth bit was ignored by the lookup, input bytes above
+	// 127 must be flagged separately. Collect both in a single bitmask:
+	*invalid = _mm512_movepi8_mask(_mm512_or_si512(translated, input));
+
+	return translated;
+}
+
+static inline __m512i
+dec_reshuffle (const __m512i input)
+{
+	// Each 32-bit lane holds four 6-bit values:
+	// [00dddddd|00cccccc|00bbbbbb|00aaaaaa]
+
+	const __m512i merge_ab_and_bc = _mm512_maddubs_epi16(input, _mm512_set1_epi32(0x01400140));
+	// [0000cccc|ccdddddd|0000aaaa|aabbbbbb]
+
+	const __m512i merged = _mm512_madd_epi16(merge_ab_and_bc, _mm512_set1_epi32(0x00011000));
+	// [00000000|aaaaaabb|bbbbcccc|ccdddddd]
+
+	// Pack the three output bytes of each lane into the lower 48 bytes of
+	// the register, swapping them to big-endian order along the way. The
+	// upper 16 bytes are don't-care:
+	const __m512i pack = _mm512_setr_epi32(0x06000102,
+	                                       0x090a0405,
+	                                       0x0c0d0e08,
+	                                       0x16101112,
+	                                       0x191a1415,
+	                                       0x1c1d1e18,
+	                                       0x26202122,
+	                                       0x292a2425,
+	                                       0x2c2d2e28,
+	                                       0x36303132,
+	                                       0x393a3435,
+	                                       0x3c3d3e38,
+	                                       0x00000000,
+	                                       0x00000000,
+	                                       0x00000000,
+	                                       0x00000000);
+
+	return _mm512_permutexvar_epi8(pack, merged);
+}
@@ -1,11 +1,11 @@
 static inline void
-enc_loop_avx512_inner (const uint8_t **s, uint8_t **o)
+enc_loop_avx512_inner (const uint8_t **s, uint8_t **o, const __m512i lookup)
 {
 	// Load input.
 	__m512i src = _mm512_loadu_si512((__m512i *) *s);
 
 	// Reshuffle, translate, store.
-	src = enc_reshuffle_translate(src);
+	src = enc_reshuffle_translate(src, lookup);
 	_mm512_storeu_si512((__m512i *) *o, src);
 
 	*s += 48;
@@ -13,49 +13,88 @@ enc_loop_avx512_inner (const uint8_t **s, uint8_t **o)
 }
 
 static inline void
-enc_loop_avx512 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_avx512_masked (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const __m512i lookup)
+{
+	// Process the remaining whole 3-byte groups, at most 48 bytes at a
+	// time. Masked-out bytes are neither loaded nor stored, so the final
+	// partial block never reads or writes beyond the bounds of the buffers.
+	while (*slen >= 3) {
+		const size_t groups = (*slen >= 48) ? 16 : *slen / 3;
+
+		const __mmask64 mask_src = ~UINT64_C(0) >> (64 - groups * 3);
+		const __mmask64 mask_dst = ~UINT64_C(0) >> (64 - groups * 4);
+
+		// Load input, zeroing the masked-out bytes.
+		__m512i src = _mm512_maskz_loadu_epi8(mask_src, *s);
+
+		// Reshuffle, translate, store the valid output bytes.
+		src = enc_reshuffle_translate(src, lookup);
+		_mm512_mask_storeu_epi8(*o, mask_dst, src);
+
+		*s    += groups * 3;
+		*o    += groups * 4;
+		*slen -= groups * 3;
+		*olen += groups * 4;
+	}
+}
+
+static inline void
+enc_loop_avx512_full (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const __m512i lookup)
 {
 	if (*slen < 64) {
 		return;
 	}
 
 	// Process blocks of 48 bytes at a time. Because blocks are loaded 64
-	// bytes at a time, ensure that there will be at least 24 remaining
+	// bytes at a time, ensure that there will be at least 16 remaining
 	// bytes after the last round, so that the final read will not pass
 	// beyond the bounds of the input buffer.
-	size_t rounds = (*slen - 24) / 48;
+	size_t rounds = (*slen - 16) / 48;
 
 	*slen -= rounds * 48;   // 48 bytes consumed per round
 	*olen += rounds * 64;   // 64 bytes produced per round
 
 	while (rounds > 0) {
 		if (rounds >= 8) {
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_avx512_inner(s, o);
-			enc_loop_avx512_inner(s, o);
+			enc_loop_avx512_inner(s, o, lookup);
+			enc_loop_avx512_inner(s, o, lookup);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_avx512_inner(s, o);
+		enc_loop_avx512_inner(s, o, lookup);
 		break;
 	}
 }
+
+static inline void
+enc_loop_avx512 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	// Load the encoding table:
+	const __m512i lookup = _mm512_loadu_si512(tables->enc_6bit);
+
+	// Encode the bulk of the input with full-width rounds, then finish the
+	// remainder with masked rounds, leaving at most two bytes for the
+	// bytewise tail:
+	enc_loop_avx512_full(s, slen, o, olen, lookup);
+	enc_loop_avx512_masked(s, slen, o, olen, lookup);
+}
@@ -0,0 +1,42 @@
+// Encode with non-temporal stores, which write the output to memory without
+// reading its lines into the cache first, and prefetch the input ahead of the
+// loads. A block is 4 rounds: three cache lines of input, four of output.
+static inline void
+enc_loop_avx512_nt (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	// The stores must be aligned:
+	if (*slen < 64 || !enc_nt_align(s, slen, o, olen, tables, 64)) {
+		return;
+	}
+
+	// Because blocks are loaded 64 bytes at a time, ensure that there will
+	// be at least 16 remaining bytes after the last block, so that the
+	// final read will not pass beyond the bounds of the input buffer:
+	size_t blocks = (*slen >= 16) ? (*slen - 16) / 192 : 0;
+
+	*slen -= blocks * 192;	// 192 bytes consumed per block
+	*olen += blocks * 256;	// 256 bytes produced per block
+
+	// Load the encoding table:
+	const __m512i lookup = _mm512_loadu_si512(tables->enc_6bit);
+
+	for (; blocks > 0; blocks--) {
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH,       _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH +  64, _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH + 128, _MM_HINT_NTA);
+
+		for (int i = 0; i < 4; i++) {
+			__m512i src = _mm512_loadu_si512((__m512i *) *s);
+
+			src = enc_reshuffle_translate(src, lookup);
+			_mm512_stream_si512((__m512i *) *o, src);
+
+			*s += 48;
+			*o += 64;
+		}
+	}
+
+	// Order the stores before those that follow, such as the release of
+	// the output to another thread:
+	_mm_sfence();
+}
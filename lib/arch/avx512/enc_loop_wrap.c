@@ -0,0 +1,76 @@
+// Store 64 characters at column `*col` of lines of `wrap`, which is at least
+// 64, see enc_wrap_store_ssse3(). The characters up to the break are stored
+// with a masked store, and those from there on are rotated to the front with
+// vpermb and stored with another, so that no scratch is written:
+static inline void
+enc_wrap_store_avx512 (uint8_t **o, const __m512i str, const __m512i lanes, size_t *col, const size_t wrap, const uint16_t eol, const size_t eollen)
+{
+	const size_t n = wrap - *col;
+	uint8_t *out = *o;
+
+	if (n >= 64) {
+		_mm512_storeu_si512(out, str);
+		*o   += 64;
+		*col += 64;
+		return;
+	}
+	_mm512_mask_storeu_epi8(out, (UINT64_C(1) << n) - 1, str);
+	memcpy(out + n, &eol, 2);
+	_mm512_mask_storeu_epi8(out + n + eollen, ~UINT64_C(0) >> n, _mm512_permutexvar_epi8(_mm512_add_epi8(lanes, _mm512_set1_epi8((char) n)), str));
+
+	*o   = out + 64 + eollen;
+	*col = 64 - n;
+}
+
+// Encode while breaking the lines of the output. Lines narrower than a block
+// are broken one quarter of the block at a time:
+static inline void
+enc_loop_avx512_wrap (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, struct base64_state *state)
+{
+	if (*slen < 64) {
+		return;
+	}
+
+	// Process blocks of 48 bytes at a time. Because blocks are loaded 64
+	// bytes at a time, ensure that there will be at least 16 remaining
+	// bytes after the last round, so that the final read will not pass
+	// beyond the bounds of the input buffer, and so that the caller stores
+	// at least 16 more characters over the scratch of the last store:
+	size_t rounds = (*slen - 16) / 48;
+
+	const size_t wrap = state->wrap;
+	size_t col = state->wrap_col;
+	uint8_t *out = *o;
+	uint16_t eol;
+	const size_t eollen = enc_wrap_eol(&eol, state->wrap_crlf);
+
+	*slen -= rounds * 48;	// 48 bytes consumed per round
+
+	// Load the encoding table, and the identity permutation:
+	const __m512i lookup = _mm512_loadu_si512(tables->enc_6bit);
+	const __m512i lanes  = _mm512_loadu_si512(dec_ignore_lanes);
+
+	if (wrap >= 64) {
+		do {
+			const __m512i str = enc_reshuffle_translate(_mm512_loadu_si512((const __m512i *) *s), lookup);
+
+			enc_wrap_store_avx512(&out, str, lanes, &col, wrap, eol, eollen);
+			*s += 48;
+		} while (--rounds > 0);
+	}
+	else {
+		do {
+			const __m512i str = enc_reshuffle_translate(_mm512_loadu_si512((const __m512i *) *s), lookup);
+
+			enc_wrap_store_ssse3(&out, _mm512_castsi512_si128(str),       &col, wrap, eol, eollen);
+			enc_wrap_store_ssse3(&out, _mm512_extracti32x4_epi32(str, 1), &col, wrap, eol, eollen);
+			enc_wrap_store_ssse3(&out, _mm512_extracti32x4_epi32(str, 2), &col, wrap, eol, eollen);
+			enc_wrap_store_ssse3(&out, _mm512_extracti32x4_epi32(str, 3), &col, wrap, eol, eollen);
+			*s += 48;
+		} while (--rounds > 0);
+	}
+
+	*olen += (size_t) (out - *o);
+	*o = out;
+	state->wrap_col = col;
+}
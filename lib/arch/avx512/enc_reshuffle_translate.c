@@ -2,7 +2,7 @@
 // https://github.com/WojciechMula/base64simd which is under BSD-2 license.
 
 static inline __m512i
-enc_reshuffle_translate (const __m512i input)
+enc_reshuffle_translate (const __m512i input, const __m512i lookup)
 {
 	// 32-bit input
 	// [ 0  0  0  0  0  0  0  0|c1 c0 d5 d4 d3 d2 d1 d0|
@@ -42,9 +42,7 @@ enc_reshuffle_translate (const __m512i input)
 	const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040alu);
 	__m512i shuffled_in = _mm512_multishift_epi64_epi8(shifts, in);
 
-	// Translate immediatedly after reshuffled.
-	const __m512i lookup = _mm512_loadu_si512(base64_table_enc_6bit);
-
-	// Translation 6-bit values to ASCII.
+	// Translate immediatedly after reshuffled: 6-bit values to ASCII, using
+	// the 64-byte encoding table of the alphabet in use.
 	return _mm512_permutexvar_epi8(shuffled_in, lookup);
 }
@@ -0,0 +1,47 @@
+#pragma once
+static inline void
+span_loop_avx512 (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the decoding table, see dec_loop_avx512():
+	const __m512i lookup_0 = _mm512_loadu_si512(tables->dec_8bit);
+	const __m512i lookup_1 = _mm512_loadu_si512(tables->dec_8bit + 64);
+
+	// Check four blocks of 64 bytes per round, without reshuffling and
+	// storing the translated values. See the SSSE3 span loops:
+	while (*slen >= 256) {
+		__mmask64 a, b, c, d;
+
+		dec_translate(_mm512_loadu_si512((const __m512i *) (*s +   0)), lookup_0, lookup_1, &a);
+		dec_translate(_mm512_loadu_si512((const __m512i *) (*s +  64)), lookup_0, lookup_1, &b);
+		dec_translate(_mm512_loadu_si512((const __m512i *) (*s + 128)), lookup_0, lookup_1, &c);
+		dec_translate(_mm512_loadu_si512((const __m512i *) (*s + 192)), lookup_0, lookup_1, &d);
+
+		if ((a | b | c | d) != 0) {
+			break;
+		}
+		*s    += 256;
+		*slen -= 256;
+	}
+
+	// Check the rest one block at a time. The final partial block is loaded
+	// with a mask, so that no byte beyond the input is read:
+	while (*slen > 0) {
+		const size_t len = (*slen >= 64) ? 64 : *slen;
+		const __mmask64 mask_src = ~UINT64_C(0) >> (64 - len);
+		__mmask64 invalid;
+
+		dec_translate(_mm512_maskz_loadu_epi8(mask_src, *s), lookup_0, lookup_1, &invalid);
+
+		// The zeroed bytes always translate to invalid values, so mask
+		// them out:
+		invalid &= mask_src;
+
+		if (invalid != 0) {
+			*s    += base64_ctz64(invalid);
+			*slen -= base64_ctz64(invalid);
+			return;
+		}
+		*s    += len;
+		*slen -= len;
+	}
+}
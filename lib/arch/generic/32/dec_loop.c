@@ -1,12 +1,12 @@
 #pragma once
 static inline int
-dec_loop_generic_32_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
+dec_loop_generic_32_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const uint32_t *d0, const uint32_t *d1, const uint32_t *d2, const uint32_t *d3)
 {
 	const uint32_t str
-		= base64_table_dec_32bit_d0[(*s)[0]]
-		| base64_table_dec_32bit_d1[(*s)[1]]
-		| base64_table_dec_32bit_d2[(*s)[2]]
-		| base64_table_dec_32bit_d3[(*s)[3]];
+		= d0[(*s)[0]]
+		| d1[(*s)[1]]
+		| d2[(*s)[2]]
+		| d3[(*s)[3]];
 
 #if BASE64_LITTLE_ENDIAN
 
@@ -31,7 +31,7 @@ dec_loop_generic_32_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
 }
 
 static inline void
-dec_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+dec_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 8) {
 		return;
@@ -46,37 +46,43 @@ dec_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 4;	// 4 bytes consumed per round
 	*olen += rounds * 3;	// 3 bytes produced per round
 
+	// Load the decoding tables:
+	const uint32_t *d0 = tables->dec_32bit_d0;
+	const uint32_t *d1 = tables->dec_32bit_d1;
+	const uint32_t *d2 = tables->dec_32bit_d2;
+	const uint32_t *d3 = tables->dec_32bit_d3;
+
 	do {
 		if (rounds >= 8) {
-			if (dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds)) {
+			if (dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 4) {
-			if (dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds)) {
+			if (dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 2) {
-			if (dec_loop_generic_32_inner(s, o, &rounds) &&
-			    dec_loop_generic_32_inner(s, o, &rounds)) {
+			if (dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3) &&
+			    dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3)) {
 				continue;
 			}
 			break;
 		}
-		dec_loop_generic_32_inner(s, o, &rounds);
+		dec_loop_generic_32_inner(s, o, &rounds, d0, d1, d2, d3);
 		break;
 
 	} while (rounds > 0);
@@ -1,5 +1,5 @@
 static inline void
-enc_loop_generic_32_inner (const uint8_t **s, uint8_t **o)
+enc_loop_generic_32_inner (const uint8_t **s, uint8_t **o, const uint16_t *table)
 {
 	uint32_t src;
 
@@ -16,15 +16,15 @@ enc_loop_generic_32_inner (const uint8_t **s, uint8_t **o)
 	const size_t index1 = (src >>  8) & 0xFFFU;
 
 	// Table lookup and store:
-	memcpy(*o + 0, base64_table_enc_12bit + index0, 2);
-	memcpy(*o + 2, base64_table_enc_12bit + index1, 2);
+	memcpy(*o + 0, table + index0, 2);
+	memcpy(*o + 2, table + index1, 2);
 
 	*s += 3;
 	*o += 4;
 }
 
 static inline void
-enc_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 4) {
 		return;
@@ -39,34 +39,37 @@ enc_loop_generic_32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 3;	// 3 bytes consumed per round
 	*olen += rounds * 4;	// 4 bytes produced per round
 
+	// Load the encoding table:
+	const uint16_t *table = tables->enc_12bit;
+
 	do {
 		if (rounds >= 8) {
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_generic_32_inner(s, o);
-			enc_loop_generic_32_inner(s, o);
+			enc_loop_generic_32_inner(s, o, table);
+			enc_loop_generic_32_inner(s, o, table);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_generic_32_inner(s, o);
+		enc_loop_generic_32_inner(s, o, table);
 		break;
 
 	} while (rounds > 0);
@@ -0,0 +1,33 @@
+#pragma once
+static inline void
+span_loop_generic_32 (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the decoding tables:
+	const uint32_t *d0 = tables->dec_32bit_d0;
+	const uint32_t *d1 = tables->dec_32bit_d1;
+	const uint32_t *d2 = tables->dec_32bit_d2;
+	const uint32_t *d3 = tables->dec_32bit_d3;
+
+#if BASE64_LITTLE_ENDIAN
+	// LUTs for little-endian set MSB in case of invalid character:
+	const uint32_t invalid = UINT32_C(0x80000000);
+#else
+	// LUTs for big-endian set LSB in case of invalid character:
+	const uint32_t invalid = UINT32_C(1);
+#endif
+
+	// Check blocks of 8 bytes per round, using the lookups of the decoder
+	// without combining and storing the output. Leave a block with an
+	// invalid byte to the bytewise tail, which finds its exact position:
+	while (*slen >= 8) {
+		const uint32_t str
+			= d0[(*s)[0]] | d1[(*s)[1]] | d2[(*s)[2]] | d3[(*s)[3]]
+			| d0[(*s)[4]] | d1[(*s)[5]] | d2[(*s)[6]] | d3[(*s)[7]];
+
+		if (str & invalid) {
+			break;
+		}
+		*s    += 8;
+		*slen -= 8;
+	}
+}
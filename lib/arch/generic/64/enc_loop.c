@@ -1,6 +1,6 @@
 #pragma once
 static inline void
-enc_loop_generic_64_inner (const uint8_t **s, uint8_t **o)
+enc_loop_generic_64_inner (const uint8_t **s, uint8_t **o, const uint16_t *table)
 {
 	uint64_t src;
 
@@ -19,17 +19,17 @@ enc_loop_generic_64_inner (const uint8_t **s, uint8_t **o)
 	const size_t index3 = (src >> 16) & 0xFFFU;
 
 	// Table lookup and store:
-	memcpy(*o + 0, base64_table_enc_12bit + index0, 2);
-	memcpy(*o + 2, base64_table_enc_12bit + index1, 2);
-	memcpy(*o + 4, base64_table_enc_12bit + index2, 2);
-	memcpy(*o + 6, base64_table_enc_12bit + index3, 2);
+	memcpy(*o + 0, table + index0, 2);
+	memcpy(*o + 2, table + index1, 2);
+	memcpy(*o + 4, table + index2, 2);
+	memcpy(*o + 6, table + index3, 2);
 
 	*s += 6;
 	*o += 8;
 }
 
 static inline void
-enc_loop_generic_64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_generic_64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 8) {
 		return;
@@ -44,34 +44,37 @@ enc_loop_generic_64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 6;	// 6 bytes consumed per round
 	*olen += rounds * 8;	// 8 bytes produced per round
 
+	// Load the encoding table:
+	const uint16_t *table = tables->enc_12bit;
+
 	do {
 		if (rounds >= 8) {
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_generic_64_inner(s, o);
-			enc_loop_generic_64_inner(s, o);
+			enc_loop_generic_64_inner(s, o, table);
+			enc_loop_generic_64_inner(s, o, table);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_generic_64_inner(s, o);
+		enc_loop_generic_64_inner(s, o, table);
 		break;
 
 	} while (rounds > 0);
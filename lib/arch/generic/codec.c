@@ -15,15 +15,16 @@
 
 #if BASE64_WORDSIZE >= 32
 #  include "32/dec_loop.c"
+#  include "32/span_loop.c"
 #endif
 
 void base64_stream_encode_plain(struct base64_state *state, const char *src, size_t srclen, char	*out, size_t *outlen)
 {
 	#include "enc_head.c"
 #if BASE64_WORDSIZE == 32
-	enc_loop_generic_32(&s, &slen, &o, &olen);
+	enc_loop_generic_32(&s, &slen, &o, &olen, tables);
 #elif BASE64_WORDSIZE == 64
-	enc_loop_generic_64(&s, &slen, &o, &olen);
+	enc_loop_generic_64(&s, &slen, &o, &olen, tables);
 #endif
 	#include "enc_tail.c"
 }
@@ -32,7 +33,16 @@ int	base64_stream_decode_plain(struct base64_state *state, const char *src, size
 {
 	#include "dec_head.c"
 #if BASE64_WORDSIZE >= 32
-	dec_loop_generic_32(&s, &slen, &o, &olen);
+	dec_loop_generic_32(&s, &slen, &o, &olen, tables);
 #endif
 	#include "dec_tail.c"
 }
+
+size_t base64_stream_span_plain(const struct base64_state *state, const char *src, size_t srclen)
+{
+	#include "span_head.c"
+#if BASE64_WORDSIZE >= 32
+	span_loop_generic_32(&s, &slen, tables);
+#endif
+	#include "span_tail.c"
+}
@@ -11,6 +11,9 @@ st.eof = state->eof;
 st.bytes = state->bytes;
 st.carry = state->carry;
 
+// Select the lookup tables for the alphabet in use:
+const struct base64_tables *tables = base64_tables_choose(state);
+
 // If we previously saw an EOF or an invalid character, bail out:
 if (st.eof) {
 	*outlen = 0;
@@ -19,7 +22,7 @@ if (st.eof) {
 	if (slen && (st.eof == BASE64_AEOF)) {
 		state->bytes = 0;
 		state->eof = BASE64_EOF;
-		ret = ((base64_table_dec_8bit[*s++] == 254) && (slen == 1)) ? 1 : 0;
+		ret = ((tables->dec_8bit[*s++] == 254) && (slen == 1)) ? 1 : 0;
 	}
 	return ret;
 }
@@ -2,7 +2,7 @@
 			ret = 1;
 			break;
 		}
-		if ((q = base64_table_dec_8bit[*s++]) >= 254) {
+		if ((q = tables->dec_8bit[*s++]) >= 254) {
 			st.eof = BASE64_EOF;
 			// Treat character '=' as invalid for byte 0:
 			break;
@@ -17,7 +17,7 @@
 			ret = 1;
 			break;
 		}
-		if ((q = base64_table_dec_8bit[*s++]) >= 254) {
+		if ((q = tables->dec_8bit[*s++]) >= 254) {
 			st.eof = BASE64_EOF;
 			// Treat character '=' as invalid for byte 1:
 			break;
@@ -34,16 +34,16 @@
 			ret = 1;
 			break;
 		}
-		if ((q = base64_table_dec_8bit[*s++]) >= 254) {
+		if ((q = tables->dec_8bit[*s++]) >= 254) {
 			st.bytes++;
-			// When q == 254, the input char is '='.
-			// Check if next byte is also '=':
-			if (q == 254) {
+			// When q == 254, the input char is '='. Check that the
+			// policy allows it here, and if next byte is also '=':
+			if (q == 254 && base64_pad_allowed(state->flags, st.carry)) {
 				if (slen-- != 0) {
 					st.bytes = 0;
 					// EOF:
 					st.eof = BASE64_EOF;
-					q = base64_table_dec_8bit[*s++];
+					q = tables->dec_8bit[*s++];
 					ret = ((q == 254) && (slen == 0)) ? 1 : 0;
 					break;
 				}
@@ -69,12 +69,13 @@
 			ret = 1;
 			break;
 		}
-		if ((q = base64_table_dec_8bit[*s++]) >= 254) {
+		if ((q = tables->dec_8bit[*s++]) >= 254) {
 			st.bytes = 0;
 			st.eof = BASE64_EOF;
-			// When q == 254, the input char is '='. Return 1 and EOF.
+			// When q == 254, the input char is '='. Return 1 and EOF,
+			// if the policy allows it here.
 			// When q == 255, the input char is invalid. Return 0 and EOF.
-			ret = ((q == 254) && (slen == 0)) ? 1 : 0;
+			ret = ((q == 254) && (slen == 0) && base64_pad_allowed(state->flags, st.carry)) ? 1 : 0;
 			break;
 		}
 		*o++ = st.carry | q;
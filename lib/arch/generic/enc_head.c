@@ -10,6 +10,9 @@ struct base64_state st;
 st.bytes = state->bytes;
 st.carry = state->carry;
 
+// Select the lookup tables for the alphabet in use:
+const struct base64_tables *tables = base64_tables_choose(state);
+
 // Turn three bytes into four 6-bit numbers:
 // in[0] = 00111111
 // in[1] = 00112222
@@ -0,0 +1,37 @@
+// Support for the encoders with non-temporal stores. These stores must be
+// aligned to the width of the vector, and so are only used once the output
+// is aligned. Every quad of output is four bytes, so that this takes a few
+// whole groups, which are encoded here with the table.
+
+// The distance at which the input is prefetched ahead of the loads, enough to
+// cover the latency of memory at the speed of the SIMD loops:
+#define BASE64_NT_PREFETCH	1024
+
+// Encode whole groups until the output is aligned to `align` bytes, a power of
+// two. Returns 0 if this is not possible, because the output is not aligned to
+// four bytes, or because the input is too short:
+static inline int
+enc_nt_align (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, size_t align)
+{
+	size_t n = (align - ((uintptr_t) *o & (align - 1))) & (align - 1);
+
+	if (n % 4 != 0 || *slen < n / 4 * 3) {
+		return 0;
+	}
+	*slen -= n / 4 * 3;
+	*olen += n;
+
+	for (; n > 0; n -= 4) {
+		const uint8_t *g = *s;
+		uint8_t *d = *o;
+
+		d[0] = tables->enc_6bit[g[0] >> 2];
+		d[1] = tables->enc_6bit[(g[0] << 4 | g[1] >> 4) & 0x3F];
+		d[2] = tables->enc_6bit[(g[1] << 2 | g[2] >> 6) & 0x3F];
+		d[3] = tables->enc_6bit[g[2] & 0x3F];
+
+		*s += 3;
+		*o += 4;
+	}
+	return 1;
+}
@@ -0,0 +1,5 @@
+const uint8_t *s = (const uint8_t *) src;
+size_t slen = srclen;
+
+// Select the lookup tables for the alphabet in use:
+const struct base64_tables *tables = base64_tables_choose(state);
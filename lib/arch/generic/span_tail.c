@@ -0,0 +1,7 @@
+// The loop above stops at the first invalid byte it finds, or leaves a short
+// remainder. Scan the rest bytewise:
+while (slen > 0 && tables->dec_8bit[*s] < 64) {
+	s++;
+	slen--;
+}
+return (size_t) (s - (const uint8_t *) src);
@@ -39,6 +39,7 @@ vqtbl1q_u8 (const uint8x16_t lut, const uint8x16_t indices)
 }
 
 #include "../generic/32/dec_loop.c"
+#include "../generic/32/span_loop.c"
 #include "../generic/32/enc_loop.c"
 #include "dec_loop.c"
 #include "enc_reshuffle.c"
@@ -49,14 +50,17 @@ vqtbl1q_u8 (const uint8x16_t lut, const uint8x16_t indices)
 
 // Stride size is so large on these NEON 32-bit functions
 // (48 bytes encode, 32 bytes decode) that we inline the
-// uint32 codec to stay performant on smaller inputs.
+// uint32 codec to stay performant on smaller inputs. The uint32 codec also
+// handles custom alphabets that do not fit the range-based NEON32 codec.
 
 void base64_stream_encode_neon32(struct base64_state *state, const char *src, size_t srclen, char	*out, size_t *outlen)
 {
 #ifdef BASE64_USE_NEON32
 	#include "../generic/enc_head.c"
-	enc_loop_neon32(&s, &slen, &o, &olen);
-	enc_loop_generic_32(&s, &slen, &o, &olen);
+	if (tables->enc_ranges) {
+		enc_loop_neon32(&s, &slen, &o, &olen, tables);
+	}
+	enc_loop_generic_32(&s, &slen, &o, &olen, tables);
 	#include "../generic/enc_tail.c"
 #else
 	BASE64_ENC_STUB
@@ -67,10 +71,23 @@ int	base64_stream_decode_neon32(struct base64_state *state, const char *src, siz
 {
 #ifdef BASE64_USE_NEON32
 	#include "../generic/dec_head.c"
-	dec_loop_neon32(&s, &slen, &o, &olen);
-	dec_loop_generic_32(&s, &slen, &o, &olen);
+	if (tables->dec_ranges) {
+		dec_loop_neon32(&s, &slen, &o, &olen, tables);
+	}
+	dec_loop_generic_32(&s, &slen, &o, &olen, tables);
 	#include "../generic/dec_tail.c"
 #else
 	BASE64_DEC_STUB
 #endif
 }
+
+size_t base64_stream_span_neon32(const struct base64_state *state, const char *src, size_t srclen)
+{
+#ifdef BASE64_USE_NEON32
+	#include "../generic/span_head.c"
+	span_loop_generic_32(&s, &slen, tables);
+	#include "../generic/span_tail.c"
+#else
+	BASE64_SPAN_STUB
+#endif
+}
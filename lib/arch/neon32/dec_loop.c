@@ -10,50 +10,35 @@ is_nonzero (const uint8x16_t v)
 }
 
 static inline uint8x16_t
-delta_lookup (const uint8x16_t v)
+delta_lookup (const uint8x16_t v, const uint8x8_t lut)
 {
-	const uint8x8_t lut = {
-		0, 16, 19, 4, (uint8_t) -65, (uint8_t) -65, (uint8_t) -71, (uint8_t) -71,
-	};
-
 	return vcombine_u8(
 		vtbl1_u8(lut, vget_low_u8(v)),
 		vtbl1_u8(lut, vget_high_u8(v)));
 }
 
 static inline uint8x16_t
-dec_loop_neon32_lane (uint8x16_t *lane)
+dec_loop_neon32_lane (uint8x16_t *lane, const uint8x16_t lut_lo, const uint8x16_t lut_hi, const uint8x8_t lut_roll, const uint8x16_t limit)
 {
 	// See the SSSE3 decoder for an explanation of the algorithm.
-	const uint8x16_t lut_lo = {
-		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
-	};
-
-	const uint8x16_t lut_hi = {
-		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
-		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
-	};
-
 	const uint8x16_t mask_0F = vdupq_n_u8(0x0F);
-	const uint8x16_t mask_2F = vdupq_n_u8(0x2F);
 
 	const uint8x16_t hi_nibbles = vshrq_n_u8(*lane, 4);
 	const uint8x16_t lo_nibbles = vandq_u8(*lane, mask_0F);
-	const uint8x16_t eq_2F      = vceqq_u8(*lane, mask_2F);
+	const uint8x16_t below      = vcltq_u8(*lane, limit);
 
 	const uint8x16_t hi = vqtbl1q_u8(lut_hi, hi_nibbles);
 	const uint8x16_t lo = vqtbl1q_u8(lut_lo, lo_nibbles);
 
 	// Now simply add the delta values to the input:
-	*lane = vaddq_u8(*lane, delta_lookup(vaddq_u8(eq_2F, hi_nibbles)));
+	*lane = vaddq_u8(*lane, delta_lookup(vaddq_u8(below, hi_nibbles), lut_roll));
 
 	// Return the validity mask:
 	return vandq_u8(lo, hi);
 }
 
 static inline void
-dec_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+dec_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 64) {
 		return;
@@ -67,6 +52,12 @@ dec_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 64;	// 64 bytes consumed per round
 	*olen += rounds * 48;	// 48 bytes produced per round
 
+	// Load the lookup tables for the alphabet in use:
+	const uint8x16_t lut_lo   = vld1q_u8(tables->dec_lut_lo);
+	const uint8x16_t lut_hi   = vld1q_u8(tables->dec_lut_hi);
+	const uint8x8_t  lut_roll = vld1_u8((const uint8_t *) tables->dec_lut_roll);
+	const uint8x16_t limit    = vdupq_n_u8(tables->dec_roll_limit);
+
 	do {
 		uint8x16x3_t dec;
 
@@ -75,10 +66,10 @@ dec_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 
 		// Decode each lane, collect a mask of invalid inputs:
 		const uint8x16_t classified
-			= dec_loop_neon32_lane(&str.val[0])
-			| dec_loop_neon32_lane(&str.val[1])
-			| dec_loop_neon32_lane(&str.val[2])
-			| dec_loop_neon32_lane(&str.val[3]);
+			= dec_loop_neon32_lane(&str.val[0], lut_lo, lut_hi, lut_roll, limit)
+			| dec_loop_neon32_lane(&str.val[1], lut_lo, lut_hi, lut_roll, limit)
+			| dec_loop_neon32_lane(&str.val[2], lut_lo, lut_hi, lut_roll, limit)
+			| dec_loop_neon32_lane(&str.val[3], lut_lo, lut_hi, lut_roll, limit);
 
 		// Check for invalid input: if any of the delta values are
 		// zero, fall back on bytewise code to do error checking and
@@ -1,6 +1,6 @@
 #ifdef BASE64_NEON32_USE_ASM
 static inline void
-enc_loop_neon32_inner_asm (const uint8_t **s, uint8_t **o)
+enc_loop_neon32_inner_asm (const uint8_t **s, uint8_t **o, const uint8x16_t lut)
 {
 	// This function duplicates the functionality of enc_loop_neon32_inner,
 	// but entirely with inline assembly. This gives a significant speedup
@@ -12,14 +12,6 @@ enc_loop_neon32_inner_asm (const uint8_t **s, uint8_t **o)
 	uint8x16_t tmp0, tmp1, tmp2, tmp3;
 	uint8x16_t mask0, mask1, mask2, mask3;
 
-	// A lookup table containing the absolute offsets for all ranges.
-	const uint8x16_t lut = {
-		  65U,  71U, 252U, 252U,
-		 252U, 252U, 252U, 252U,
-		 252U, 252U, 252U, 252U,
-		 237U, 240U,   0U,   0U
-	};
-
 	// Numeric constants.
 	const uint8x16_t n51 = vdupq_n_u8(51);
 	const uint8x16_t n25 = vdupq_n_u8(25);
@@ -107,10 +99,10 @@ enc_loop_neon32_inner_asm (const uint8_t **s, uint8_t **o)
 #endif
 
 static inline void
-enc_loop_neon32_inner (const uint8_t **s, uint8_t **o)
+enc_loop_neon32_inner (const uint8_t **s, uint8_t **o, const uint8x16_t lut)
 {
 #ifdef BASE64_NEON32_USE_ASM
-	enc_loop_neon32_inner_asm(s, o);
+	enc_loop_neon32_inner_asm(s, o, lut);
 #else
 	// Load 48 bytes and deinterleave:
 	uint8x16x3_t src = vld3q_u8(*s);
@@ -119,7 +111,7 @@ enc_loop_neon32_inner (const uint8_t **s, uint8_t **o)
 	uint8x16x4_t out = enc_reshuffle(src);
 
 	// Translate reshuffled bytes to the Base64 alphabet:
-	out = enc_translate(out);
+	out = enc_translate(out, lut);
 
 	// Interleave and store output:
 	vst4q_u8(*o, out);
@@ -130,41 +122,45 @@ enc_loop_neon32_inner (const uint8_t **s, uint8_t **o)
 }
 
 static inline void
-enc_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_neon32 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	size_t rounds = *slen / 48;
 
 	*slen -= rounds * 48;	// 48 bytes consumed per round
 	*olen += rounds * 64;	// 64 bytes produced per round
 
+	// A lookup table containing the absolute offsets for all ranges, for
+	// the alphabet in use:
+	const uint8x16_t lut = vld1q_u8((const uint8_t *) tables->enc_lut);
+
 	while (rounds > 0) {
 		if (rounds >= 8) {
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_neon32_inner(s, o);
-			enc_loop_neon32_inner(s, o);
+			enc_loop_neon32_inner(s, o, lut);
+			enc_loop_neon32_inner(s, o, lut);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_neon32_inner(s, o);
+		enc_loop_neon32_inner(s, o, lut);
 		break;
 	}
 }
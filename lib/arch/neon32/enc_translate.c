@@ -1,13 +1,8 @@
 static inline uint8x16x4_t
-enc_translate (const uint8x16x4_t in)
+enc_translate (const uint8x16x4_t in, const uint8x16_t lut)
 {
-	// A lookup table containing the absolute offsets for all ranges:
-	const uint8x16_t lut = {
-		 65U,  71U, 252U, 252U,
-		252U, 252U, 252U, 252U,
-		252U, 252U, 252U, 252U,
-		237U, 240U,   0U,   0U
-	};
+	// The lookup table `lut` contains the absolute offsets for all ranges.
+	// See the SSSE3 encoder for the values.
 
 	const uint8x16_t offset = vdupq_n_u8(51);
 
@@ -55,6 +55,7 @@ load_64byte_table (const uint8_t *p)
 }
 
 #include "../generic/32/dec_loop.c"
+#include "../generic/32/span_loop.c"
 #include "../generic/64/enc_loop.c"
 #include "dec_loop.c"
 
@@ -75,8 +76,8 @@ void base64_stream_encode_neon64(struct base64_state *state, const char *src, si
 {
 #ifdef BASE64_USE_NEON64
 	#include "../generic/enc_head.c"
-	enc_loop_neon64(&s, &slen, &o, &olen);
-	enc_loop_generic_64(&s, &slen, &o, &olen);
+	enc_loop_neon64(&s, &slen, &o, &olen, tables);
+	enc_loop_generic_64(&s, &slen, &o, &olen, tables);
 	#include "../generic/enc_tail.c"
 #else
 	BASE64_ENC_STUB
@@ -87,10 +88,21 @@ int	base64_stream_decode_neon64(struct base64_state *state, const char *src, siz
 {
 #ifdef BASE64_USE_NEON64
 	#include "../generic/dec_head.c"
-	dec_loop_neon64(&s, &slen, &o, &olen);
-	dec_loop_generic_32(&s, &slen, &o, &olen);
+	dec_loop_neon64(&s, &slen, &o, &olen, tables);
+	dec_loop_generic_32(&s, &slen, &o, &olen, tables);
 	#include "../generic/dec_tail.c"
 #else
 	BASE64_DEC_STUB
 #endif
 }
+
+size_t base64_stream_span_neon64(const struct base64_state *state, const char *src, size_t srclen)
+{
+#ifdef BASE64_USE_NEON64
+	#include "../generic/span_head.c"
+	span_loop_generic_32(&s, &slen, tables);
+	#include "../generic/span_tail.c"
+#else
+	BASE64_SPAN_STUB
+#endif
+}
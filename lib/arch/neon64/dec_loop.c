@@ -17,23 +17,13 @@
 // (12) Everything else => invalid input
 
 // The first LUT will use the VTBL instruction (out of range indices are set to
-// 0 in destination).
-static const uint8_t dec_lut1[] = {
-	255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U,
-	255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U,
-	255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U, 255U,  62U, 255U, 255U, 255U,  63U,
-	 52U,  53U,  54U,  55U,  56U,  57U,  58U,  59U,  60U,  61U, 255U, 255U, 255U, 255U, 255U, 255U,
-};
-
+// 0 in destination). It consists of the first 64 entries of the bytewise
+// decoding table, `dec_8bit`.
+//
 // The second LUT will use the VTBX instruction (out of range indices will be
 // unchanged in destination). Input [64..126] will be mapped to index [1..63]
-// in this LUT. Index 0 means that value comes from LUT #1.
-static const uint8_t dec_lut2[] = {
-	  0U, 255U,   0U,   1U,   2U,   3U,   4U,   5U,   6U,   7U,   8U,   9U,  10U,  11U,  12U,  13U,
-	 14U,  15U,  16U,  17U,  18U,  19U,  20U,  21U,  22U,  23U,  24U,  25U, 255U, 255U, 255U, 255U,
-	255U, 255U,  26U,  27U,  28U,  29U,  30U,  31U,  32U,  33U,  34U,  35U,  36U,  37U,  38U,  39U,
-	 40U,  41U,  42U,  43U,  44U,  45U,  46U,  47U,  48U,  49U,  50U,  51U, 255U, 255U, 255U, 255U,
-};
+// in this LUT. Index 0 means that value comes from LUT #1. This table is
+// found as `dec_lut_neon64` in the base64_tables struct.
 
 // All input values in range for the first look-up will be 0U in the second
 // look-up result. All input values out of range for the first look-up will be
@@ -41,7 +31,7 @@ static const uint8_t dec_lut2[] = {
 // conflicts.
 //
 // Invalid characters that are in the valid range for either look-up will be
-// set to 255U in the combined result. Other invalid characters will just be
+// set to 254U or 255U in the combined result. Other invalid characters will be
 // passed through with the second look-up result (using the VTBX instruction).
 // Since the second LUT is 64 bytes, those passed-through values are guaranteed
 // to have a value greater than 63U. Therefore, valid characters will be mapped
@@ -49,7 +39,7 @@ static const uint8_t dec_lut2[] = {
 // values greater than 63.
 
 static inline void
-dec_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+dec_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 64) {
 		return;
@@ -63,8 +53,9 @@ dec_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 64;	// 64 bytes consumed per round
 	*olen += rounds * 48;	// 48 bytes produced per round
 
-	const uint8x16x4_t tbl_dec1 = load_64byte_table(dec_lut1);
-	const uint8x16x4_t tbl_dec2 = load_64byte_table(dec_lut2);
+	// Load the lookup tables for the alphabet in use:
+	const uint8x16x4_t tbl_dec1 = load_64byte_table(tables->dec_8bit);
+	const uint8x16x4_t tbl_dec2 = load_64byte_table(tables->dec_lut_neon64);
 
 	do {
 		const uint8x16_t offset = vdupq_n_u8(63U);
@@ -78,7 +78,7 @@
 #pragma GCC diagnostic ignored "-Woverlength-strings"
 
 static inline void
-enc_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	size_t rounds = *slen / 48;
 
@@ -154,7 +154,7 @@ enc_loop_neon64 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 
 		// Inputs (not modified).
 		: [rounds] "r" (rounds),
-		  [tbl]    "r" (base64_table_enc_6bit),
+		  [tbl]    "r" (tables->enc_6bit),
 		  [n63]    "w" (vdupq_n_u8(63))
 
 		// Clobbers.
@@ -17,10 +17,10 @@
 // declaration (register and/or memory access).
 //
 // For offsets:
-// Perfect hash for lut = ((src >> 4) & 0x2F) + ((src == 0x2F) ? 0xFF : 0x00)
+// Perfect hash for lut = ((src >> 4) & 0x2F) + ((src < 0x2F) ? 0xFF : 0x00)
 // 0000 = garbage
-// 0001 = /
-// 0010 = +
+// 0001 = +
+// 0010 = /
 // 0011 = 0-9
 // 0100 = A-Z
 // 0101 = A-Z
@@ -65,22 +65,20 @@
 // 1101 0x10 andlut     0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10
 // 1110 0x10 andlut     0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10
 // 1111 0x10 andlut     0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10 0x10
+//
+// The tables above are for the standard alphabet. The tables for the URL-safe
+// alphabet follow the same scheme, with '-' and '_' in place of '+' and '/'.
+// Since '_' shares its high nibble with P..Z, the offset hash uses 0x5F ('_')
+// as the limit, which shifts all characters below '_' down by one slot:
+// 0001 = -, 0010 = 0-9, 0011 = A-O, 0100 = P-Z, 0101 = _, 0110 = a-o, 0111 = p-z.
+// Row 0x7 gets its own validation bit, 0x20, because DEL is invalid while '_'
+// is valid. All tables are found in the base64_tables struct. The tables for
+// custom alphabets are generated at runtime by base64_tables_generate(), and
+// alphabets that do not fit this scheme are decoded by dec_loop_ssse3_lookup().
 
 static inline int
-dec_loop_ssse3_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
+dec_loop_ssse3_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const __m128i lut_lo, const __m128i lut_hi, const __m128i lut_roll, const __m128i limit)
 {
-	const __m128i lut_lo = _mm_setr_epi8(
-		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
-
-	const __m128i lut_hi = _mm_setr_epi8(
-		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
-		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
-
-	const __m128i lut_roll = _mm_setr_epi8(
-		0,  16,  19,   4, -65, -65, -71, -71,
-		0,   0,   0,   0,   0,   0,   0,   0);
-
 	const __m128i mask_2F = _mm_set1_epi8(0x2F);
 
 	// Load input:
@@ -98,8 +96,8 @@ dec_loop_ssse3_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
 		return 0;
 	}
 
-	const __m128i eq_2F = _mm_cmpeq_epi8(str, mask_2F);
-	const __m128i roll  = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi_nibbles));
+	const __m128i below = _mm_cmpgt_epi8(limit, str);
+	const __m128i roll  = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(below, hi_nibbles));
 
 	// Now simply add the delta values to the input:
 	str = _mm_add_epi8(str, roll);
@@ -118,7 +116,7 @@ dec_loop_ssse3_inner (const uint8_t **s, uint8_t **o, size_t *rounds)
 }
 
 static inline void
-dec_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+dec_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 24) {
 		return;
@@ -133,37 +131,43 @@ dec_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 16;	// 16 bytes consumed per round
 	*olen += rounds * 12;	// 12 bytes produced per round
 
+	// Load the lookup tables for the alphabet in use:
+	const __m128i lut_lo   = _mm_loadu_si128((const __m128i *) tables->dec_lut_lo);
+	const __m128i lut_hi   = _mm_loadu_si128((const __m128i *) tables->dec_lut_hi);
+	const __m128i lut_roll = _mm_loadu_si128((const __m128i *) tables->dec_lut_roll);
+	const __m128i limit    = _mm_set1_epi8((char) tables->dec_roll_limit);
+
 	do {
 		if (rounds >= 8) {
-			if (dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds)) {
+			if (dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 4) {
-			if (dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds)) {
+			if (dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
 		if (rounds >= 2) {
-			if (dec_loop_ssse3_inner(s, o, &rounds) &&
-			    dec_loop_ssse3_inner(s, o, &rounds)) {
+			if (dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit) &&
+			    dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit)) {
 				continue;
 			}
 			break;
 		}
-		dec_loop_ssse3_inner(s, o, &rounds);
+		dec_loop_ssse3_inner(s, o, &rounds, lut_lo, lut_hi, lut_roll, limit);
 		break;
 
 	} while (rounds > 0);
@@ -0,0 +1,304 @@
+#pragma once
+// These helpers decode while skipping the bytes of an ignore set, such as the
+// line breaks of MIME or PEM input. Each block of input is looked up in the
+// nibble tables of the decoder as usual. If any of its bytes is not in the
+// alphabet, it is also looked up in the bitmap of the bytes to skip, and
+// compared against each byte of the sequences of the set, if any. The bytes
+// that a sequence covers are skipped too, even into the next block. The block
+// is translated to 6-bit values, and the kept lanes are compacted with a
+// shuffle from base64_table_compact and appended to a staging buffer, from
+// which runs of values are reshuffled and stored. The loops stop before the
+// first block that holds any other byte, such as padding or invalid input,
+// and leave it to the caller, along with the staged values.
+
+// Check whether any of the bytes to skip or the first bytes of sequences is
+// in the alphabet, in which case the loops look at every block:
+static inline int
+dec_ignore_overlap (const struct base64_tables *tables, const struct base64_ignore_set *set)
+{
+	const __m128i flag = _mm_set1_epi8(BASE64_IGNORE_BYTE | BASE64_IGNORE_SEQ);
+	const __m128i max  = _mm_set1_epi8(63);
+	__m128i any = _mm_setzero_si128();
+	int i;
+
+	for (i = 0; i < 128; i += 16) {
+		const __m128i skip = _mm_and_si128(_mm_loadu_si128((const __m128i *) (set->table + i)), flag);
+		const __m128i dec  = _mm_loadu_si128((const __m128i *) (tables->dec_8bit + i));
+
+		any = _mm_or_si128(any, _mm_and_si128(skip, _mm_cmpeq_epi8(_mm_min_epu8(dec, max), dec)));
+	}
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) != 0xFFFF;
+}
+
+// Convert the pending characters handed over by the caller to 6-bit values,
+// and back again when the loop ends:
+static inline void
+dec_ignore_load_pending (uint8_t *buf, const uint8_t *pending, size_t npend, const struct base64_tables *tables)
+{
+	size_t i;
+
+	for (i = 0; i < npend; i++) {
+		buf[i] = tables->dec_8bit[pending[i]];
+	}
+}
+
+static inline void
+dec_ignore_save_pending (uint8_t *pending, const uint8_t *buf, size_t npend, const struct base64_tables *tables)
+{
+	size_t i;
+
+	for (i = 0; i < npend; i++) {
+		pending[i] = tables->enc_6bit[buf[i]];
+	}
+}
+
+// Match the sequences that may start in the lanes of `seq`, in order, and add
+// the lanes that they cover to `*skip`. The bytes that a sequence covers do
+// not start one themselves. Those past the block of `width` bytes are set in
+// `*carry`, to be skipped at the start of the next block. Returns 0 if the
+// input ends in the middle of a sequence:
+static inline int
+dec_ignore_seqs (const struct base64_ignore_set *set, const uint8_t *c, size_t len, uint64_t seq, uint64_t *skip, uint64_t *carry, const unsigned int width)
+{
+	while (seq != 0) {
+		const unsigned int pos = base64_ctz64(seq);
+		const int r = base64_ignore_match(set, c + pos, len - pos);
+
+		if (r < 0) {
+			return 0;
+		}
+		seq &= seq - 1;
+
+		if (r > 0) {
+			const uint64_t run = (UINT64_C(1) << r) - 1;
+
+			*skip |= run << pos;
+			seq   &= ~(run << pos);
+
+			if (pos + (unsigned int) r > width) {
+				*carry = run >> (width - pos);
+			}
+		}
+	}
+	return 1;
+}
+
+// Match the sequences in a block of 16 bytes with wide compares, given the
+// lanes in `*skip` that the end of a sequence covers. Each sequence is found
+// at all lanes at once, where no shorter one starts, and the lanes that the
+// matches cover are set in `*skip` and `*carry` as above. The input must
+// extend past the longest sequence from the last lane. Returns 0 without
+// setting either if the matches overlap, which dec_ignore_seqs() resolves in
+// order of position instead:
+static inline int
+dec_ignore_seqs_ssse3 (const struct base64_ignore_set *set, const uint8_t *c, uint64_t *skip, uint64_t *carry)
+{
+	uint64_t starts = *skip, cover = *skip;
+	int i, j;
+
+	for (i = 0; i < set->nseqs; i++) {
+		uint64_t m = ~starts;
+
+		for (j = 0; j < set->seqlen[i]; j++) {
+			const __m128i str = _mm_loadu_si128((const __m128i *) (c + j));
+
+			m &= (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(str, _mm_set1_epi8((char) set->seq[i][j])));
+		}
+		starts |= m;
+
+		for (j = 0; j < set->seqlen[i]; j++) {
+			if (cover & (m << j)) {
+				return 0;
+			}
+			cover |= m << j;
+		}
+	}
+	*skip  = cover & 0xFFFF;
+	*carry = cover >> 16;
+	return 1;
+}
+
+// Return the mask of the lanes of a block to keep, given the bitmap of the
+// bytes to skip. The high nibble selects one bit of the bitmap entry, and
+// bytes above 127 select none. Given the bitmap of the first bytes of
+// sequences, the lanes of those are clear:
+static inline uint32_t
+dec_ignore_keep_ssse3 (const __m128i lo_nibbles, const __m128i hi_nibbles, const __m128i skip_lut)
+{
+	const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i skip = _mm_and_si128(_mm_shuffle_epi8(skip_lut, lo_nibbles), _mm_shuffle_epi8(bits, hi_nibbles));
+
+	return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(skip, _mm_setzero_si128()));
+}
+
+// Store the lanes in the 16-bit mask `keep` to `dst`, in order, and return
+// their number. Each half of the block is compacted with a shuffle from the
+// table, and stored with 8 bytes, of which the lanes past the kept ones are
+// overwritten by the next store:
+static inline size_t
+dec_ignore_compact_ssse3 (uint8_t *dst, const __m128i val, const uint32_t keep)
+{
+	const size_t lo = base64_table_compact_len[keep & 0xFF];
+	const size_t hi = base64_table_compact_len[keep >> 8];
+
+	const __m128i idx_lo = _mm_loadl_epi64((const __m128i *) base64_table_compact[keep & 0xFF]);
+	const __m128i idx_hi = _mm_add_epi8(_mm_loadl_epi64((const __m128i *) base64_table_compact[keep >> 8]), _mm_set1_epi8(8));
+
+	_mm_storel_epi64((__m128i *) dst, _mm_shuffle_epi8(val, idx_lo));
+	_mm_storel_epi64((__m128i *) (dst + lo), _mm_shuffle_epi8(val, idx_hi));
+
+	return lo + hi;
+}
+
+// Reshuffle and store 16 values. The full store writes 4 bytes of scratch
+// past the 12 bytes of output. The output of a call stays within
+// base64_decoded_length_max() of its input as long as 16 more bytes of input
+// follow, since they hold at least 12 bytes of room. Otherwise store exactly
+// the output:
+static inline void
+dec_ignore_store_ssse3 (uint8_t **o, const __m128i val, const size_t left)
+{
+	const __m128i str = dec_reshuffle_sse3(val);
+
+	if (left >= 16) {
+		_mm_storeu_si128((__m128i *) *o, str);
+	}
+	else {
+		const uint32_t last = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(str, 8));
+
+		_mm_storel_epi64((__m128i *) *o, str);
+		memcpy(*o + 8, &last, sizeof (last));
+	}
+	*o += 12;
+}
+
+static BASE64_FORCE_INLINE void
+dec_loop_ssse3_ignore_body (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending, const int seqs)
+{
+	const uint8_t *c = *s;
+	uint8_t *out = *o;
+	size_t len = *slen;
+	size_t npend = *npending;
+	uint8_t stage[256 + 16];
+	uint64_t carry = 0;
+	size_t i;
+
+	const int overlap = dec_ignore_overlap(tables, set);
+
+	// Load the lookup tables for the alphabet in use, and the bitmap of
+	// the bytes to skip:
+	const __m128i lut_lo   = _mm_loadu_si128((const __m128i *) tables->dec_lut_lo);
+	const __m128i lut_hi   = _mm_loadu_si128((const __m128i *) tables->dec_lut_hi);
+	const __m128i lut_roll = _mm_loadu_si128((const __m128i *) tables->dec_lut_roll);
+	const __m128i limit    = _mm_set1_epi8((char) tables->dec_roll_limit);
+	const __m128i skip_lut = _mm_loadu_si128((const __m128i *) set->skip_lut);
+	const __m128i mask_2F  = _mm_set1_epi8(0x2F);
+
+	dec_ignore_load_pending(stage, pending, npend, tables);
+
+	while (len >= 16) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) c);
+		uint32_t keep = 0xFFFF;
+
+		// Table lookups, see dec_loop_ssse3():
+		const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+		const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
+		const __m128i hi         = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+		const __m128i lo         = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+		const uint32_t invalid   = (uint32_t) _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128()));
+
+		// Translate to 6-bit values:
+		const __m128i below = _mm_cmpgt_epi8(limit, str);
+		const __m128i val   = _mm_add_epi8(str, _mm_shuffle_epi8(lut_roll, _mm_add_epi8(below, hi_nibbles)));
+
+		// Only blocks with bytes outside the alphabet can hold bytes
+		// to skip, unless they overlap or a sequence runs into them:
+		if (invalid != 0 || overlap || carry != 0) {
+			uint64_t skip = carry, next = 0;
+
+			keep = dec_ignore_keep_ssse3(lo_nibbles, hi_nibbles, skip_lut);
+
+			// Match the sequences with wide compares, or one at a
+			// time where they overlap or near the end of the input:
+			if (seqs) {
+				if (len < 16 + BASE64_IGNORE_SEQLEN - 1 || !dec_ignore_seqs_ssse3(set, c, &skip, &next)) {
+					const __m128i seq_lut = _mm_loadu_si128((const __m128i *) set->seq_lut);
+					const uint64_t seq = (dec_ignore_keep_ssse3(lo_nibbles, hi_nibbles, seq_lut) ^ 0xFFFF) & ~carry;
+
+					if (!dec_ignore_seqs(set, c, len, seq, &skip, &next, 16)) {
+						break;
+					}
+				}
+				keep &= (uint32_t) ~skip;
+			}
+			if (invalid & keep) {
+				break;
+			}
+			carry = next;
+		}
+
+		// Compact the block into the staging buffer:
+		if (keep != 0xFFFF) {
+			npend += dec_ignore_compact_ssse3(stage + npend, val, keep);
+		}
+		else {
+			_mm_storeu_si128((__m128i *) (stage + npend), val);
+			npend += 16;
+		}
+
+		c   += 16;
+		len -= 16;
+
+		// Decode the staged values in runs of 256, and move the rest
+		// to the front. The wide loads of values that were just stored
+		// in narrow pieces stall until those stores retire, which the
+		// long runs make rare:
+		if (npend >= 256) {
+			for (i = 0; i < 256; i += 16) {
+				dec_ignore_store_ssse3(&out, _mm_loadu_si128((const __m128i *) (stage + i)), len);
+			}
+			_mm_storeu_si128((__m128i *) stage, _mm_loadu_si128((const __m128i *) (stage + 256)));
+			npend -= 256;
+		}
+	}
+
+	// Consume the end of a sequence that ran into the next block:
+	if (carry != 0) {
+		i = base64_ctz64(~carry);
+		c   += i;
+		len -= i;
+	}
+
+	// Decode the remaining runs of 16:
+	for (i = 0; npend - i >= 16; i += 16) {
+		dec_ignore_store_ssse3(&out, _mm_loadu_si128((const __m128i *) (stage + i)), len);
+	}
+	dec_ignore_save_pending(pending, stage + i, npend - i, tables);
+	npend -= i;
+
+	*npending = npend;
+	*olen += (size_t) (out - *o);
+	*slen  = len;
+	*s     = c;
+	*o     = out;
+}
+
+// The loop for sets with sequences is compiled into a function of its own,
+// since the matching takes registers that the other sets need for the lookup
+// tables:
+static BASE64_NOINLINE void
+dec_loop_ssse3_ignore_seqs (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	dec_loop_ssse3_ignore_body(s, slen, o, olen, tables, set, pending, npending, 1);
+}
+
+static inline void
+dec_loop_ssse3_ignore (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, const struct base64_ignore_set *set, uint8_t *pending, size_t *npending)
+{
+	if (set->nseqs > 0) {
+		dec_loop_ssse3_ignore_seqs(s, slen, o, olen, tables, set, pending, npending);
+	}
+	else {
+		dec_loop_ssse3_ignore_body(s, slen, o, olen, tables, set, pending, npending, 0);
+	}
+}
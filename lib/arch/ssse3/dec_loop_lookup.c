@@ -0,0 +1,130 @@
+#pragma once
+static inline __m128i
+dec_translate_lookup (const __m128i str, const __m128i *lut)
+{
+	// Translate the input to 6-bit values with eight 16-byte lookups into
+	// the first half of the bytewise decoding table. This works just like
+	// enc_translate_lookup(): lookup #i returns zero for inputs below 16*i,
+	// and XORing the rows leaves the value for the row of each input:
+	const __m128i step = _mm_set1_epi8(16);
+
+	__m128i indices = str;
+	__m128i out = _mm_shuffle_epi8(lut[0], indices);
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[1], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[2], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[3], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[4], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[5], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[6], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	return _mm_xor_si128(out, _mm_shuffle_epi8(lut[7], indices));
+}
+
+static inline int
+dec_loop_ssse3_lookup_inner (const uint8_t **s, uint8_t **o, size_t *rounds, const __m128i *lut)
+{
+	// Load input:
+	__m128i str = _mm_loadu_si128((__m128i *) *s);
+
+	// Translate to 6-bit values:
+	const __m128i values = dec_translate_lookup(str, lut);
+
+	// Check for invalid input: invalid characters (and the padding
+	// character) translate to values with the high bit set. Input bytes
+	// above 127 return garbage from the lookups, so flag them separately.
+	// Fall back on bytewise code to do error checking and reporting:
+	if (_mm_movemask_epi8(_mm_or_si128(values, str)) != 0) {
+		return 0;
+	}
+
+	// Reshuffle the input to packed 12-byte output format:
+	str = dec_reshuffle_sse3(values);
+
+	// Store the output:
+	_mm_storeu_si128((__m128i *) *o, str);
+
+	*s += 16;
+	*o += 12;
+	*rounds -= 1;
+
+	return 1;
+}
+
+// Decoder for alphabets that do not fit the range-based decoder:
+static inline void
+dec_loop_ssse3_lookup (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	if (*slen < 24) {
+		return;
+	}
+
+	// Process blocks of 16 bytes per round, see dec_loop_ssse3():
+	size_t rounds = (*slen - 8) / 16;
+
+	*slen -= rounds * 16;	// 16 bytes consumed per round
+	*olen += rounds * 12;	// 12 bytes produced per round
+
+	// Load the lookup table rows:
+	const __m128i lut[8] = {
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 0),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 1),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 2),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 3),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 4),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 5),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 6),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 7),
+	};
+
+	do {
+		if (rounds >= 8) {
+			if (dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 4) {
+			if (dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		if (rounds >= 2) {
+			if (dec_loop_ssse3_lookup_inner(s, o, &rounds, lut) &&
+			    dec_loop_ssse3_lookup_inner(s, o, &rounds, lut)) {
+				continue;
+			}
+			break;
+		}
+		dec_loop_ssse3_lookup_inner(s, o, &rounds, lut);
+		break;
+
+	} while (rounds > 0);
+
+	// Adjust for any rounds that were skipped:
+	*slen += rounds * 16;
+	*olen -= rounds * 12;
+}
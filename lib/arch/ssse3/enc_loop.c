@@ -1,5 +1,5 @@
 static inline void
-enc_loop_ssse3_inner (const uint8_t **s, uint8_t **o)
+enc_loop_ssse3_inner (const uint8_t **s, uint8_t **o, const __m128i lut)
 {
 	// Load input:
 	__m128i str = _mm_loadu_si128((__m128i *) *s);
@@ -8,7 +8,7 @@ enc_loop_ssse3_inner (const uint8_t **s, uint8_t **o)
 	str = enc_reshuffle(str);
 
 	// Translate reshuffled bytes to the Base64 alphabet:
-	str = enc_translate(str);
+	str = enc_translate(str, lut);
 
 	// Store:
 	_mm_storeu_si128((__m128i *) *o, str);
@@ -18,7 +18,7 @@ enc_loop_ssse3_inner (const uint8_t **s, uint8_t **o)
 }
 
 static inline void
-enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	if (*slen < 16) {
 		return;
@@ -33,34 +33,37 @@ enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	*slen -= rounds * 12;	// 12 bytes consumed per round
 	*olen += rounds * 16;	// 16 bytes produced per round
 
+	// Load the translation table for the alphabet in use:
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
 	do {
 		if (rounds >= 8) {
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
 			rounds -= 8;
 			continue;
 		}
 		if (rounds >= 4) {
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
 			rounds -= 4;
 			continue;
 		}
 		if (rounds >= 2) {
-			enc_loop_ssse3_inner(s, o);
-			enc_loop_ssse3_inner(s, o);
+			enc_loop_ssse3_inner(s, o, lut);
+			enc_loop_ssse3_inner(s, o, lut);
 			rounds -= 2;
 			continue;
 		}
-		enc_loop_ssse3_inner(s, o);
+		enc_loop_ssse3_inner(s, o, lut);
 		break;
 
 	} while (rounds > 0);
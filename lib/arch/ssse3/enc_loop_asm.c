@@ -124,7 +124,7 @@
 #pragma GCC diagnostic ignored "-Woverlength-strings"
 
 static inline void
-enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
+enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
 {
 	// For a clearer explanation of the algorithm used by this function,
 	// please refer to the plain (not inline assembly) implementation. This
@@ -148,12 +148,11 @@ enc_loop_ssse3 (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen)
 	// Number of rounds remaining after the 36x loop.
 	rounds %= 36;
 
-	// Lookup tables.
+	// Lookup tables. The second table depends on the alphabet in use.
 	const __m128i lut0 = _mm_set_epi8(
 		10, 11,  9, 10,  7,  8,  6,  7,  4,  5,  3,  4,  1,  2,  0,  1);
 
-	const __m128i lut1 = _mm_setr_epi8(
-		65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+	const __m128i lut1 = _mm_loadu_si128((const __m128i *) tables->enc_lut);
 
 	// Temporary registers.
 	__m128i a, b, c, d, e, f;
@@ -0,0 +1,98 @@
+static inline __m128i
+enc_translate_lookup (const __m128i in, const __m128i *lut)
+{
+	// Translate values 0..63 to an arbitrary alphabet with four 16-byte
+	// table lookups. The shuffle uses only the low nibble of each index,
+	// but returns zero when the high bit of the index is set. Lookup #i
+	// is indexed by the input minus 16*i, so it returns zero for values
+	// below 16*i. Each row holds the XOR of two consecutive rows of the
+	// alphabet, so XORing the lookups leaves the character for the row of
+	// each value:
+	const __m128i step = _mm_set1_epi8(16);
+
+	__m128i indices = in;
+	__m128i out = _mm_shuffle_epi8(lut[0], indices);
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[1], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	out = _mm_xor_si128(out, _mm_shuffle_epi8(lut[2], indices));
+
+	indices = _mm_sub_epi8(indices, step);
+	return _mm_xor_si128(out, _mm_shuffle_epi8(lut[3], indices));
+}
+
+static inline void
+enc_loop_ssse3_lookup_inner (const uint8_t **s, uint8_t **o, const __m128i *lut)
+{
+	// Load input:
+	__m128i str = _mm_loadu_si128((__m128i *) *s);
+
+	// Reshuffle:
+	str = enc_reshuffle(str);
+
+	// Translate reshuffled bytes to the alphabet:
+	str = enc_translate_lookup(str, lut);
+
+	// Store:
+	_mm_storeu_si128((__m128i *) *o, str);
+
+	*s += 12;
+	*o += 16;
+}
+
+// Encoder for alphabets that do not fit the range-based encoder:
+static inline void
+enc_loop_ssse3_lookup (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	if (*slen < 16) {
+		return;
+	}
+
+	// Process blocks of 12 bytes at a time, see enc_loop_ssse3():
+	size_t rounds = (*slen - 4) / 12;
+
+	*slen -= rounds * 12;	// 12 bytes consumed per round
+	*olen += rounds * 16;	// 16 bytes produced per round
+
+	// Load the lookup table rows:
+	const __m128i lut[4] = {
+		_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 0),
+		_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 1),
+		_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 2),
+		_mm_loadu_si128((const __m128i *) tables->enc_lut_xor + 3),
+	};
+
+	do {
+		if (rounds >= 8) {
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			rounds -= 8;
+			continue;
+		}
+		if (rounds >= 4) {
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			rounds -= 4;
+			continue;
+		}
+		if (rounds >= 2) {
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			enc_loop_ssse3_lookup_inner(s, o, lut);
+			rounds -= 2;
+			continue;
+		}
+		enc_loop_ssse3_lookup_inner(s, o, lut);
+		break;
+
+	} while (rounds > 0);
+}
@@ -0,0 +1,43 @@
+// Encode with non-temporal stores, which write the output to memory without
+// reading its lines into the cache first, and prefetch the input ahead of the
+// loads. A block is 16 rounds: three cache lines of input, four of output.
+static inline void
+enc_loop_ssse3_nt (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables)
+{
+	// The stores must be aligned:
+	if (*slen < 16 || !enc_nt_align(s, slen, o, olen, tables, 16)) {
+		return;
+	}
+
+	// Because blocks are loaded 16 bytes at a time, ensure that there will
+	// be at least 4 remaining bytes after the last block, so that the final
+	// read will not pass beyond the bounds of the input buffer:
+	size_t blocks = (*slen >= 4) ? (*slen - 4) / 192 : 0;
+
+	*slen -= blocks * 192;	// 192 bytes consumed per block
+	*olen += blocks * 256;	// 256 bytes produced per block
+
+	// Load the translation table for the alphabet in use:
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
+	for (; blocks > 0; blocks--) {
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH,       _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH +  64, _MM_HINT_NTA);
+		_mm_prefetch((const char *) *s + BASE64_NT_PREFETCH + 128, _MM_HINT_NTA);
+
+		for (int i = 0; i < 16; i++) {
+			__m128i str = _mm_loadu_si128((__m128i *) *s);
+
+			str = enc_reshuffle(str);
+			str = enc_translate(str, lut);
+			_mm_stream_si128((__m128i *) *o, str);
+
+			*s += 12;
+			*o += 16;
+		}
+	}
+
+	// Order the stores before those that follow, such as the release of
+	// the output to another thread:
+	_mm_sfence();
+}
@@ -0,0 +1,39 @@
+// Encode while breaking the lines of the output, see enc_wrap_store_ssse3():
+static inline void
+enc_loop_ssse3_wrap (const uint8_t **s, size_t *slen, uint8_t **o, size_t *olen, const struct base64_tables *tables, struct base64_state *state)
+{
+	if (*slen < 24) {
+		return;
+	}
+
+	// Process blocks of 12 bytes at a time. Leave at least 12 bytes of
+	// input after the last round, so that the final read will not pass
+	// beyond the bounds of the input buffer, and so that the caller stores
+	// at least 16 more characters over the scratch of the last store:
+	size_t rounds = (*slen - 12) / 12;
+
+	const size_t wrap = state->wrap;
+	size_t col = state->wrap_col;
+	uint8_t *out = *o;
+	uint16_t eol;
+	const size_t eollen = enc_wrap_eol(&eol, state->wrap_crlf);
+
+	*slen -= rounds * 12;	// 12 bytes consumed per round
+
+	// Load the translation table for the alphabet in use:
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
+	do {
+		__m128i str = _mm_loadu_si128((__m128i *) *s);
+
+		str = enc_reshuffle(str);
+		str = enc_translate(str, lut);
+		enc_wrap_store_ssse3(&out, str, &col, wrap, eol, eollen);
+
+		*s += 12;
+	} while (--rounds > 0);
+
+	*olen += (size_t) (out - *o);
+	*o = out;
+	state->wrap_col = col;
+}
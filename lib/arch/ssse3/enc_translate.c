@@ -1,13 +1,10 @@
 static inline __m128i
-enc_translate (const __m128i in)
+enc_translate (const __m128i in, const __m128i lut)
 {
-	// A lookup table containing the absolute offsets for all ranges:
-	const __m128i lut = _mm_setr_epi8(
-		 65,  71, -4, -4,
-		 -4,  -4, -4, -4,
-		 -4,  -4, -4, -4,
-		-19, -16,  0,  0
-	);
+	// The lookup table `lut` contains the absolute offsets for all ranges.
+	// For the standard alphabet, it is:
+	//   { 65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0 }
+	// The URL-safe alphabet differs only in the offsets for sets #3 and #4.
 
 	// Translate values 0..63 to the Base64 alphabet. There are five sets:
 	// #  From      To         Abs    Index  Characters
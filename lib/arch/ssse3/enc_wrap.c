@@ -0,0 +1,48 @@
+#pragma once
+// These helpers break the lines of the encoder output as it is stored, for
+// base64_stream_set_wrap(). A line break goes out before the first character
+// that does not fit on the line, so that the output never ends in one.
+
+// Get the line break as the value of a 16-bit store, and return its length. A
+// LF is stored twice, and the second one is overwritten:
+static inline size_t
+enc_wrap_eol (uint16_t *eol, const int crlf)
+{
+	memcpy(eol, crlf ? "\r\n" : "\n\n", 2);
+	return crlf ? 2 : 1;
+}
+
+// The indices of a shuffle that moves the lanes from `n` on to the front,
+// loaded from offset `n`:
+static const uint8_t enc_wrap_shift[32] = {
+	   0,    1,    2,    3,    4,    5,    6,    7,
+	   8,    9,   10,   11,   12,   13,   14,   15,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+// Store 16 characters at column `*col` of lines of `wrap`, which is at least
+// 16, so that the block holds at most one line break, which may also come
+// before its first character. A block with a break is stored whole, then the
+// line break at the break position, and then the characters from there on
+// again after it. That store writes up to 15 bytes of scratch past the block,
+// so the caller must have more output to store after it:
+static inline void
+enc_wrap_store_ssse3 (uint8_t **o, const __m128i str, size_t *col, const size_t wrap, const uint16_t eol, const size_t eollen)
+{
+	const size_t n = wrap - *col;
+	uint8_t *out = *o;
+
+	_mm_storeu_si128((__m128i *) out, str);
+
+	if (n >= 16) {
+		*o   += 16;
+		*col += 16;
+		return;
+	}
+	memcpy(out + n, &eol, 2);
+	_mm_storeu_si128((__m128i *) (out + n + eollen), _mm_shuffle_epi8(str, _mm_loadu_si128((const __m128i *) (enc_wrap_shift + n))));
+
+	*o   = out + 16 + eollen;
+	*col = 16 - n;
+}
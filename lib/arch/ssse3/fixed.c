@@ -0,0 +1,370 @@
+// Fixed-width kernels for base64_encode_16() and friends. The sizes are known,
+// so that each kernel is a straight line of whole-vector operations: groups of
+// twelve bytes at the end of the input are loaded so that they overlap the
+// groups before them, and the last store of the output overlaps the one before
+// it. Only the standard and URL-safe alphabets reach these kernels, and the
+// only branch is on whether the output is padded.
+
+// Encode the twelve bytes in the low lanes of `in` to sixteen characters:
+static inline __m128i
+enc_fixed_ssse3 (const __m128i in, const __m128i lut)
+{
+	return enc_translate(enc_reshuffle(in), lut);
+}
+
+// Put the padding character in the lanes of `str` that are set in `mask`:
+static inline __m128i
+enc_fixed_pad_ssse3 (const __m128i str, const __m128i mask, const struct base64_tables *tables)
+{
+	return _mm_or_si128(_mm_andnot_si128(mask, str), _mm_and_si128(mask, _mm_set1_epi8((char) tables->pad)));
+}
+
+static inline int
+enc_fixed_padded_ssse3 (int flags)
+{
+	return !(flags & (BASE64_NOPAD | BASE64_FORBID_PAD));
+}
+
+static void
+enc_fixed_ssse3_16 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+	const __m128i in  = _mm_loadu_si128((const __m128i *) src);
+
+	// Bytes 0..11, and bytes 12..15 followed by zeros:
+	const __m128i a = enc_fixed_ssse3(in, lut);
+	const __m128i b = enc_fixed_ssse3(_mm_srli_si128(in, 12), lut);
+
+	_mm_storeu_si128((__m128i *) out, a);
+
+	// Characters 16..23, of which the last two are padding:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i p = enc_fixed_pad_ssse3(b, _mm_setr_epi8(0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 8), _mm_alignr_epi8(p, a, 8));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 6), _mm_alignr_epi8(b, a, 6));
+	}
+}
+
+static void
+enc_fixed_ssse3_20 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
+	// Bytes 0..11, and bytes 12..19 from an overlapping load:
+	const __m128i a = enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) src), lut);
+	const __m128i b = enc_fixed_ssse3(_mm_srli_si128(_mm_loadu_si128((const __m128i *) (src + 4)), 8), lut);
+
+	_mm_storeu_si128((__m128i *) out, a);
+
+	// Characters 16..27, of which the last one is padding:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i p = enc_fixed_pad_ssse3(b, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 12), _mm_alignr_epi8(p, a, 12));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 11), _mm_alignr_epi8(b, a, 11));
+	}
+}
+
+static void
+enc_fixed_ssse3_32 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
+	// Bytes 0..11, 12..23, and 24..31 from an overlapping load:
+	const __m128i a = enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) src), lut);
+	const __m128i b = enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 12)), lut);
+	const __m128i c = enc_fixed_ssse3(_mm_srli_si128(_mm_loadu_si128((const __m128i *) (src + 16)), 8), lut);
+
+	_mm_storeu_si128((__m128i *) out, a);
+	_mm_storeu_si128((__m128i *) (out + 16), b);
+
+	// Characters 32..43, of which the last one is padding:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i p = enc_fixed_pad_ssse3(c, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 28), _mm_alignr_epi8(p, b, 12));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 27), _mm_alignr_epi8(c, b, 11));
+	}
+}
+
+static void
+enc_fixed_ssse3_48 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+
+	// Four whole rounds, the last from an overlapping load. There is no
+	// padding:
+	_mm_storeu_si128((__m128i *) (out +  0), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src +  0)), lut));
+	_mm_storeu_si128((__m128i *) (out + 16), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 12)), lut));
+	_mm_storeu_si128((__m128i *) (out + 32), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 24)), lut));
+	_mm_storeu_si128((__m128i *) (out + 48), enc_fixed_ssse3(_mm_srli_si128(_mm_loadu_si128((const __m128i *) (src + 32)), 4), lut));
+}
+
+static void
+enc_fixed_ssse3_64 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const __m128i lut = _mm_loadu_si128((const __m128i *) tables->enc_lut);
+	const __m128i in  = _mm_loadu_si128((const __m128i *) (src + 48));
+
+	// Five whole rounds, and bytes 60..63 from the last load:
+	const __m128i e = enc_fixed_ssse3(in, lut);
+	const __m128i f = enc_fixed_ssse3(_mm_srli_si128(in, 12), lut);
+
+	_mm_storeu_si128((__m128i *) (out +  0), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src +  0)), lut));
+	_mm_storeu_si128((__m128i *) (out + 16), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 12)), lut));
+	_mm_storeu_si128((__m128i *) (out + 32), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 24)), lut));
+	_mm_storeu_si128((__m128i *) (out + 48), enc_fixed_ssse3(_mm_loadu_si128((const __m128i *) (src + 36)), lut));
+	_mm_storeu_si128((__m128i *) (out + 64), e);
+
+	// Characters 80..87, of which the last two are padding:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i p = enc_fixed_pad_ssse3(f, _mm_setr_epi8(0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0), tables);
+		_mm_storeu_si128((__m128i *) (out + 72), _mm_alignr_epi8(p, e, 8));
+	} else {
+		_mm_storeu_si128((__m128i *) (out + 70), _mm_alignr_epi8(f, e, 6));
+	}
+}
+
+// Translate sixteen characters to their 6-bit values as dec_loop_ssse3() does,
+// and flag the invalid ones with a nonzero byte in `bad`:
+static inline __m128i
+dec_fixed_translate_ssse3 (const __m128i str, const struct base64_tables *tables, __m128i *bad)
+{
+	const __m128i lut_lo   = _mm_loadu_si128((const __m128i *) tables->dec_lut_lo);
+	const __m128i lut_hi   = _mm_loadu_si128((const __m128i *) tables->dec_lut_hi);
+	const __m128i lut_roll = _mm_loadu_si128((const __m128i *) tables->dec_lut_roll);
+	const __m128i limit    = _mm_set1_epi8((char) tables->dec_roll_limit);
+	const __m128i mask_2F  = _mm_set1_epi8(0x2F);
+
+	const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+	const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
+	const __m128i hi         = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+	const __m128i lo         = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+
+	*bad = _mm_or_si128(*bad, _mm_and_si128(lo, hi));
+
+	const __m128i below = _mm_cmpgt_epi8(limit, str);
+	const __m128i roll  = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(below, hi_nibbles));
+
+	return _mm_add_epi8(str, roll);
+}
+
+// Shuffle the last characters of the input into place with `ctrl`. The lanes
+// that it clears, which include those of the padding, get the character for
+// zero, so that they pass the checks and add no bits:
+static inline __m128i
+dec_fixed_tail_ssse3 (const __m128i str, const __m128i ctrl, const struct base64_tables *tables)
+{
+	const __m128i fill = _mm_and_si128(_mm_cmplt_epi8(ctrl, _mm_setzero_si128()), _mm_set1_epi8((char) tables->enc_6bit[0]));
+
+	return _mm_or_si128(_mm_shuffle_epi8(str, ctrl), fill);
+}
+
+// Flag the lanes of `str` that are set in `mask` but do not hold the padding
+// character. The decoded length is fixed, so that padding anywhere else is an
+// invalid character:
+static inline __m128i
+dec_fixed_pads_ssse3 (const __m128i str, const __m128i mask, const struct base64_tables *tables)
+{
+	return _mm_and_si128(_mm_xor_si128(str, _mm_set1_epi8((char) tables->pad)), mask);
+}
+
+// Under BASE64_STRICT, flag the unused bits of the last character, whose lane
+// in the values of the tail is set to `mask`:
+static inline __m128i
+dec_fixed_strict_ssse3 (const __m128i values, const __m128i mask, int flags)
+{
+	return (flags & BASE64_STRICT) ? _mm_and_si128(values, mask) : _mm_setzero_si128();
+}
+
+static inline int
+dec_fixed_valid_ssse3 (const __m128i bad)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(bad, _mm_setzero_si128())) == 0xFFFF;
+}
+
+static int
+dec_fixed_ssse3_16 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m128i bad = _mm_setzero_si128();
+	__m128i b;
+
+	// Characters 16..21, and two pads unless disabled:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 8));
+		b = dec_fixed_tail_ssse3(str, _mm_setr_epi8(8, 9, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+		bad = dec_fixed_pads_ssse3(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 6));
+		b = dec_fixed_tail_ssse3(str, _mm_setr_epi8(10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m128i a = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) src), tables, &bad);
+	b = dec_fixed_translate_ssse3(b, tables, &bad);
+	bad = _mm_or_si128(bad, dec_fixed_strict_ssse3(b, _mm_setr_epi8(0, 0, 0, 0, 0, 0x0F, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), flags));
+
+	if (!dec_fixed_valid_ssse3(bad)) {
+		return 0;
+	}
+
+	// Bytes 0..11 and 12..15:
+	const __m128i da = dec_reshuffle_sse3(a);
+	const __m128i db = dec_reshuffle_sse3(b);
+
+	_mm_storeu_si128((__m128i *) out, _mm_or_si128(da, _mm_slli_si128(db, 12)));
+	return 1;
+}
+
+static int
+dec_fixed_ssse3_20 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m128i bad = _mm_setzero_si128();
+	__m128i b;
+
+	// Characters 16..26, and a pad unless disabled:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 12));
+		b = dec_fixed_tail_ssse3(str, _mm_setr_epi8(4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -1, -1, -1, -1, -1), tables);
+		bad = dec_fixed_pads_ssse3(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 11));
+		b = dec_fixed_tail_ssse3(str, _mm_setr_epi8(5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m128i a = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) src), tables, &bad);
+	b = dec_fixed_translate_ssse3(b, tables, &bad);
+	bad = _mm_or_si128(bad, dec_fixed_strict_ssse3(b, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03, 0, 0, 0, 0, 0), flags));
+
+	if (!dec_fixed_valid_ssse3(bad)) {
+		return 0;
+	}
+
+	// Bytes 0..11 and 12..19, stored as 0..15 and 4..19:
+	const __m128i da = dec_reshuffle_sse3(a);
+	const __m128i db = dec_reshuffle_sse3(b);
+
+	_mm_storeu_si128((__m128i *) out, _mm_or_si128(da, _mm_slli_si128(db, 12)));
+	_mm_storeu_si128((__m128i *) (out + 4), _mm_or_si128(_mm_srli_si128(da, 4), _mm_slli_si128(db, 8)));
+	return 1;
+}
+
+static int
+dec_fixed_ssse3_32 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m128i bad = _mm_setzero_si128();
+	__m128i c;
+
+	// Characters 32..42, and a pad unless disabled:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 28));
+		c = dec_fixed_tail_ssse3(str, _mm_setr_epi8(4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -1, -1, -1, -1, -1), tables);
+		bad = dec_fixed_pads_ssse3(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 27));
+		c = dec_fixed_tail_ssse3(str, _mm_setr_epi8(5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m128i a = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) src), tables, &bad);
+	const __m128i b = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 16)), tables, &bad);
+	c = dec_fixed_translate_ssse3(c, tables, &bad);
+	bad = _mm_or_si128(bad, dec_fixed_strict_ssse3(c, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03, 0, 0, 0, 0, 0), flags));
+
+	if (!dec_fixed_valid_ssse3(bad)) {
+		return 0;
+	}
+
+	// Bytes 0..11, 12..23 and 24..31, stored as two vectors:
+	const __m128i da = dec_reshuffle_sse3(a);
+	const __m128i db = dec_reshuffle_sse3(b);
+	const __m128i dc = dec_reshuffle_sse3(c);
+
+	_mm_storeu_si128((__m128i *) out,        _mm_or_si128(da, _mm_slli_si128(db, 12)));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm_srli_si128(db, 4), _mm_slli_si128(dc, 8)));
+	return 1;
+}
+
+static int
+dec_fixed_ssse3_48 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m128i bad = _mm_setzero_si128();
+
+	// Four whole rounds, without padding:
+	const __m128i a = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src +  0)), tables, &bad);
+	const __m128i b = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 16)), tables, &bad);
+	const __m128i c = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 32)), tables, &bad);
+	const __m128i d = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 48)), tables, &bad);
+
+	if (!dec_fixed_valid_ssse3(bad)) {
+		return 0;
+	}
+
+	// Pack the four 12-byte results into three vectors:
+	const __m128i da = dec_reshuffle_sse3(a);
+	const __m128i db = dec_reshuffle_sse3(b);
+	const __m128i dc = dec_reshuffle_sse3(c);
+	const __m128i dd = dec_reshuffle_sse3(d);
+
+	_mm_storeu_si128((__m128i *) out,        _mm_or_si128(da, _mm_slli_si128(db, 12)));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm_srli_si128(db, 4), _mm_slli_si128(dc, 8)));
+	_mm_storeu_si128((__m128i *) (out + 32), _mm_or_si128(_mm_srli_si128(dc, 8), _mm_slli_si128(dd, 4)));
+	return 1;
+}
+
+static int
+dec_fixed_ssse3_64 (const char *src, char *out, int flags)
+{
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	__m128i bad = _mm_setzero_si128();
+	__m128i f;
+
+	// Characters 80..85, and two pads unless disabled:
+	if (enc_fixed_padded_ssse3(flags)) {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 72));
+		f = dec_fixed_tail_ssse3(str, _mm_setr_epi8(8, 9, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+		bad = dec_fixed_pads_ssse3(str, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1), tables);
+	} else {
+		const __m128i str = _mm_loadu_si128((const __m128i *) (src + 70));
+		f = dec_fixed_tail_ssse3(str, _mm_setr_epi8(10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1), tables);
+	}
+
+	const __m128i a = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src +  0)), tables, &bad);
+	const __m128i b = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 16)), tables, &bad);
+	const __m128i c = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 32)), tables, &bad);
+	const __m128i d = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 48)), tables, &bad);
+	const __m128i e = dec_fixed_translate_ssse3(_mm_loadu_si128((const __m128i *) (src + 64)), tables, &bad);
+	f = dec_fixed_translate_ssse3(f, tables, &bad);
+	bad = _mm_or_si128(bad, dec_fixed_strict_ssse3(f, _mm_setr_epi8(0, 0, 0, 0, 0, 0x0F, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), flags));
+
+	if (!dec_fixed_valid_ssse3(bad)) {
+		return 0;
+	}
+
+	// Pack five 12-byte results and the last four bytes into four vectors:
+	const __m128i da = dec_reshuffle_sse3(a);
+	const __m128i db = dec_reshuffle_sse3(b);
+	const __m128i dc = dec_reshuffle_sse3(c);
+	const __m128i dd = dec_reshuffle_sse3(d);
+	const __m128i de = dec_reshuffle_sse3(e);
+	const __m128i df = dec_reshuffle_sse3(f);
+
+	_mm_storeu_si128((__m128i *) out,        _mm_or_si128(da, _mm_slli_si128(db, 12)));
+	_mm_storeu_si128((__m128i *) (out + 16), _mm_or_si128(_mm_srli_si128(db, 4), _mm_slli_si128(dc, 8)));
+	_mm_storeu_si128((__m128i *) (out + 32), _mm_or_si128(_mm_srli_si128(dc, 8), _mm_slli_si128(dd, 4)));
+	_mm_storeu_si128((__m128i *) (out + 48), _mm_or_si128(de, _mm_slli_si128(df, 12)));
+	return 1;
+}
+
+// The table entry of the codecs that build these kernels:
+#define BASE64_FIXED_SSSE3 \
+	{ { enc_fixed_ssse3_16, enc_fixed_ssse3_20, enc_fixed_ssse3_32, enc_fixed_ssse3_48, enc_fixed_ssse3_64 } \
+	, { dec_fixed_ssse3_16, dec_fixed_ssse3_20, dec_fixed_ssse3_32, dec_fixed_ssse3_48, dec_fixed_ssse3_64 } }
@@ -0,0 +1,110 @@
+#pragma once
+// These loops check the input with the validation step of the decoders, but
+// skip the translation, reshuffle and store. Four blocks are checked per round
+// and their results combined, so that the branch is taken once per 64 bytes.
+// After a round with an invalid byte, the blocks are checked one at a time to
+// find its position.
+
+static inline __m128i
+span_classify_ssse3 (const __m128i str, const __m128i lut_lo, const __m128i lut_hi)
+{
+	const __m128i mask_2F = _mm_set1_epi8(0x2F);
+
+	// Table lookups, see dec_loop_ssse3(). A byte is valid if and only if
+	// the "and" of its two lookups is zero:
+	const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+	const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
+	const __m128i hi         = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+	const __m128i lo         = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+
+	return _mm_and_si128(lo, hi);
+}
+
+static inline void
+span_loop_ssse3 (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the lookup tables for the alphabet in use:
+	const __m128i lut_lo = _mm_loadu_si128((const __m128i *) tables->dec_lut_lo);
+	const __m128i lut_hi = _mm_loadu_si128((const __m128i *) tables->dec_lut_hi);
+	const __m128i zero   = _mm_setzero_si128();
+
+	while (*slen >= 64) {
+		const __m128i a = span_classify_ssse3(_mm_loadu_si128((const __m128i *) (*s +  0)), lut_lo, lut_hi);
+		const __m128i b = span_classify_ssse3(_mm_loadu_si128((const __m128i *) (*s + 16)), lut_lo, lut_hi);
+		const __m128i c = span_classify_ssse3(_mm_loadu_si128((const __m128i *) (*s + 32)), lut_lo, lut_hi);
+		const __m128i d = span_classify_ssse3(_mm_loadu_si128((const __m128i *) (*s + 48)), lut_lo, lut_hi);
+
+		const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xFFFF) {
+			break;
+		}
+		*s    += 64;
+		*slen -= 64;
+	}
+
+	while (*slen >= 16) {
+		const __m128i bad = span_classify_ssse3(_mm_loadu_si128((const __m128i *) *s), lut_lo, lut_hi);
+
+		// Flag the bytes with a nonzero "and" value:
+		const uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(bad, zero)) ^ 0xFFFF;
+
+		if (mask != 0) {
+			*s    += base64_ctz32(mask);
+			*slen -= base64_ctz32(mask);
+			return;
+		}
+		*s    += 16;
+		*slen -= 16;
+	}
+}
+
+static inline __m128i
+span_classify_ssse3_lookup (const __m128i str, const __m128i *lut)
+{
+	// Invalid characters translate to values with the high bit set, and
+	// input bytes above 127 have it set themselves, see
+	// dec_loop_ssse3_lookup():
+	return _mm_or_si128(dec_translate_lookup(str, lut), str);
+}
+
+static inline void
+span_loop_ssse3_lookup (const uint8_t **s, size_t *slen, const struct base64_tables *tables)
+{
+	// Load the lookup table rows:
+	const __m128i lut[8] = {
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 0),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 1),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 2),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 3),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 4),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 5),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 6),
+		_mm_loadu_si128((const __m128i *) tables->dec_lut_xor + 7),
+	};
+
+	while (*slen >= 64) {
+		const __m128i a = span_classify_ssse3_lookup(_mm_loadu_si128((const __m128i *) (*s +  0)), lut);
+		const __m128i b = span_classify_ssse3_lookup(_mm_loadu_si128((const __m128i *) (*s + 16)), lut);
+		const __m128i c = span_classify_ssse3_lookup(_mm_loadu_si128((const __m128i *) (*s + 32)), lut);
+		const __m128i d = span_classify_ssse3_lookup(_mm_loadu_si128((const __m128i *) (*s + 48)), lut);
+
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+			break;
+		}
+		*s    += 64;
+		*slen -= 64;
+	}
+
+	while (*slen >= 16) {
+		const uint32_t mask = (uint32_t) _mm_movemask_epi8(span_classify_ssse3_lookup(_mm_loadu_si128((const __m128i *) *s), lut));
+
+		if (mask != 0) {
+			*s    += base64_ctz32(mask);
+			*slen -= base64_ctz32(mask);
+			return;
+		}
+		*s    += 16;
+		*slen -= 16;
+	}
+}
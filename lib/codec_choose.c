@@ -51,6 +51,9 @@
 #ifndef BASE64_bit_AVX512vbmi
 #define BASE64_bit_AVX512vbmi (1 << 1)
 #endif
+#ifndef BASE64_bit_AVX512vbmi2
+#define BASE64_bit_AVX512vbmi2 (1 << 6)
+#endif
 #ifndef BASE64_bit_AVX2
 #define BASE64_bit_AVX2 (1 << 5)
 #endif
@@ -96,67 +99,157 @@ int	base64_stream_decode_sse41(struct base64_state *state, const char *src, size
 int	base64_stream_decode_sse42(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
 int	base64_stream_decode_avx(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
 
-static bool
-codec_choose_forced (struct base64_codec *codec, int flags)
+size_t	base64_stream_span_avx512(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_avx2(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_neon32(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_neon64(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_plain(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_ssse3(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_sse41(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_sse42(const struct base64_state *state, const char *src, size_t srclen);
+size_t	base64_stream_span_avx(const struct base64_state *state, const char *src, size_t srclen);
+
+size_t	base64_stream_decode_ignore_avx512(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_avx512_vbmi2(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_avx2(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_ssse3(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_sse41(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_sse42(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+size_t	base64_stream_decode_ignore_avx(struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+
+size_t	base64_stream_encode_wrap_avx512(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+size_t	base64_stream_encode_wrap_avx2(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+size_t	base64_stream_encode_wrap_ssse3(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+size_t	base64_stream_encode_wrap_sse41(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+size_t	base64_stream_encode_wrap_sse42(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+size_t	base64_stream_encode_wrap_avx(struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+
+// One constant table entry per codec. Stream states point at these, so that
+// the choice of codec is never shared between states. The second argument is
+// the largest input that is faster on the short path of lib_small.c. The x86
+// codecs catch up once their SIMD loops run a round or two, and the masked
+// loads of the AVX512 codec handle all but the tiniest inputs faster. The
+// third argument is the table of fixed-width kernels, if any, the fourth is
+// the decoder loop that skips ignore sets, if any, and the fifth the encoder
+// loop that breaks lines, if any. A codec can also be a variant of the
+// functions of an arch, under a name of its own:
+#define BASE64_CODEC_NAMED(name, arch, small, fixed, ignore, wrap) \
+	const struct base64_codec base64_codec_ ## name = \
+		{ base64_stream_encode_ ## arch, base64_stream_decode_ ## arch, base64_stream_span_ ## arch \
+		, small, (small + 2) / 3 * 4, fixed, ignore, wrap }
+
+#define BASE64_CODEC(arch, small, fixed, ignore, wrap) \
+	BASE64_CODEC_NAMED(arch, arch, small, fixed, ignore, wrap)
+
+// Codecs that were not built have no short path, so that their stubs still
+// fail when they are forced:
+#define BASE64_CODEC_STUB(arch) \
+	BASE64_CODEC(arch, 0, NULL, NULL, NULL)
+
+#if BASE64_HAVE_AVX512
+BASE64_CODEC(avx512, 16, &base64_fixed_avx512, base64_stream_decode_ignore_avx512, base64_stream_encode_wrap_avx512);
+BASE64_CODEC_NAMED(avx512_vbmi2, avx512, 16, &base64_fixed_avx512, base64_stream_decode_ignore_avx512_vbmi2, base64_stream_encode_wrap_avx512);
+#else
+BASE64_CODEC_STUB(avx512);
+BASE64_CODEC_NAMED(avx512_vbmi2, avx512, 0, NULL, NULL, NULL);
+#endif
+
+#if BASE64_HAVE_AVX2
+BASE64_CODEC(avx2, 48, &base64_fixed_avx2, base64_stream_decode_ignore_avx2, base64_stream_encode_wrap_avx2);
+#else
+BASE64_CODEC_STUB(avx2);
+#endif
+
+#if BASE64_HAVE_NEON32
+BASE64_CODEC(neon32, 64, NULL, NULL, NULL);
+#else
+BASE64_CODEC_STUB(neon32);
+#endif
+
+#if BASE64_HAVE_NEON64
+BASE64_CODEC(neon64, 64, NULL, NULL, NULL);
+#else
+BASE64_CODEC_STUB(neon64);
+#endif
+
+BASE64_CODEC(plain, 64, NULL, NULL, NULL);
+
+#if BASE64_HAVE_SSSE3
+BASE64_CODEC(ssse3, 48, &base64_fixed_ssse3, base64_stream_decode_ignore_ssse3, base64_stream_encode_wrap_ssse3);
+#else
+BASE64_CODEC_STUB(ssse3);
+#endif
+
+#if BASE64_HAVE_SSE41
+BASE64_CODEC(sse41, 48, &base64_fixed_sse41, base64_stream_decode_ignore_sse41, base64_stream_encode_wrap_sse41);
+#else
+BASE64_CODEC_STUB(sse41);
+#endif
+
+#if BASE64_HAVE_SSE42
+BASE64_CODEC(sse42, 48, &base64_fixed_sse42, base64_stream_decode_ignore_sse42, base64_stream_encode_wrap_sse42);
+#else
+BASE64_CODEC_STUB(sse42);
+#endif
+
+#if BASE64_HAVE_AVX
+BASE64_CODEC(avx, 48, &base64_fixed_avx, base64_stream_decode_ignore_avx, base64_stream_encode_wrap_avx);
+#else
+BASE64_CODEC_STUB(avx);
+#endif
+
+// The result of the runtime feature detection, which is done only once. CPU
+// features don't change at runtime, so threads racing to fill it in all store
+// the same pointer to constant data:
+const struct base64_codec *base64_codec_detected = NULL;
+
+static const struct base64_codec *
+codec_choose_forced (int flags)
 {
 	// If the user wants to use a certain codec,
 	// always allow it, even if the codec is a no-op.
 	// For testing purposes.
 
 	if (!(flags & 0xFFFF)) {
-		return false;
+		return NULL;
 	}
 
 	// if (flags & BASE64_FORCE_AVX2) {
-	// 	codec->enc = base64_stream_encode_avx2;
-	// 	codec->dec = base64_stream_decode_avx2;
-	// 	return true;
+	// 	return &base64_codec_avx2;
 	// }
 	// if (flags & BASE64_FORCE_NEON32) {
-	// 	codec->enc = base64_stream_encode_neon32;
-	// 	codec->dec = base64_stream_decode_neon32;
-	// 	return true;
+	// 	return &base64_codec_neon32;
 	// }
 	// if (flags & BASE64_FORCE_NEON64) {
-	// 	codec->enc = base64_stream_encode_neon64;
-	// 	codec->dec = base64_stream_decode_neon64;
-	// 	return true;
+	// 	return &base64_codec_neon64;
 	// }
 	if (flags & BASE64_FORCE_PLAIN) {
-		codec->enc = base64_stream_encode_plain;
-		codec->dec = base64_stream_decode_plain;
-		return true;
+		return &base64_codec_plain;
 	}
 	if (flags & BASE64_FORCE_SSSE3) {
-		codec->enc = base64_stream_encode_ssse3;
-		codec->dec = base64_stream_decode_ssse3;
-		return true;
+		return &base64_codec_ssse3;
 	}
 	if (flags & BASE64_FORCE_SSE41) {
-		codec->enc = base64_stream_encode_sse41;
-		codec->dec = base64_stream_decode_sse41;
-		return true;
+		return &base64_codec_sse41;
 	}
 	if (flags & BASE64_FORCE_SSE42) {
-		codec->enc = base64_stream_encode_sse42;
-		codec->dec = base64_stream_decode_sse42;
-		return true;
+		return &base64_codec_sse42;
 	}
 	if (flags & BASE64_FORCE_AVX) {
-		codec->enc = base64_stream_encode_avx;
-		codec->dec = base64_stream_decode_avx;
-		return true;
+		return &base64_codec_avx;
 	}
 	if (flags & BASE64_FORCE_AVX512) {
-		codec->enc = base64_stream_encode_avx512;
-		codec->dec = base64_stream_decode_avx512;
-		return true;
+		// Keep the AVX512-VBMI2 variant if the CPU has it:
+		if (BASE64_LOAD_CODEC(base64_codec_detected) == &base64_codec_avx512_vbmi2) {
+			return &base64_codec_avx512_vbmi2;
+		}
+		return &base64_codec_avx512;
 	}
-	return false;
+	return NULL;
 }
 
-static bool
-codec_choose_arm (struct base64_codec *codec)
+static const struct base64_codec *
+codec_choose_arm (void)
 {
 #if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && ((defined(__aarch64__) && BASE64_HAVE_NEON64) || BASE64_HAVE_NEON32)
 
@@ -165,23 +258,18 @@ codec_choose_arm (struct base64_codec *codec)
 	// has cpuid, so just stick to the compile-time configuration:
 
 	#if defined(__aarch64__) && BASE64_HAVE_NEON64
-	codec->enc = base64_stream_encode_neon64;
-	codec->dec = base64_stream_decode_neon64;
+	return &base64_codec_neon64;
 	#else
-	codec->enc = base64_stream_encode_neon32;
-	codec->dec = base64_stream_decode_neon32;
+	return &base64_codec_neon32;
 	#endif
 
-	return true;
-
 #else
-	(void)codec;
-	return false;
+	return NULL;
 #endif
 }
 
-static bool
-codec_choose_x86 (struct base64_codec *codec)
+static const struct base64_codec *
+codec_choose_x86 (void)
 {
 #ifdef BASE64_X86_SIMD
 
@@ -217,9 +305,12 @@ codec_choose_x86 (struct base64_codec *codec)
 				if (max_level >= 7) {
 					__cpuid_count(7, 0, eax, ebx, ecx, edx);
 					if ((ebx & BASE64_bit_AVX512vl) && (ecx & BASE64_bit_AVX512vbmi)) {
-						codec->enc = base64_stream_encode_avx512;
-						codec->dec = base64_stream_decode_avx512;
-						return true;
+						#ifdef BASE64_VBMI2_TARGET
+						if (ecx & BASE64_bit_AVX512vbmi2) {
+							return &base64_codec_avx512_vbmi2;
+						}
+						#endif
+						return &base64_codec_avx512;
 					}
 				}
 				#endif
@@ -227,18 +318,14 @@ codec_choose_x86 (struct base64_codec *codec)
 				if (max_level >= 7) {
 					__cpuid_count(7, 0, eax, ebx, ecx, edx);
 					if (ebx & BASE64_bit_AVX2) {
-						codec->enc = base64_stream_encode_avx2;
-						codec->dec = base64_stream_decode_avx2;
-						return true;
+						return &base64_codec_avx2;
 					}
 				}
 				#endif
 				#if BASE64_HAVE_AVX
 				__cpuid_count(1, 0, eax, ebx, ecx, edx);
 				if (ecx & BASE64_bit_AVX) {
-					codec->enc = base64_stream_encode_avx;
-					codec->dec = base64_stream_decode_avx;
-					return true;
+					return &base64_codec_avx;
 				}
 				#endif
 			}
@@ -251,9 +338,7 @@ codec_choose_x86 (struct base64_codec *codec)
 	if (max_level >= 1) {
 		__cpuid(1, eax, ebx, ecx, edx);
 		if (ecx & BASE64_bit_SSE42) {
-			codec->enc = base64_stream_encode_sse42;
-			codec->dec = base64_stream_decode_sse42;
-			return true;
+			return &base64_codec_sse42;
 		}
 	}
 	#endif
@@ -263,9 +348,7 @@ codec_choose_x86 (struct base64_codec *codec)
 	if (max_level >= 1) {
 		__cpuid(1, eax, ebx, ecx, edx);
 		if (ecx & BASE64_bit_SSE41) {
-			codec->enc = base64_stream_encode_sse41;
-			codec->dec = base64_stream_decode_sse41;
-			return true;
+			return &base64_codec_sse41;
 		}
 	}
 	#endif
@@ -275,35 +358,44 @@ codec_choose_x86 (struct base64_codec *codec)
 	if (max_level >= 1) {
 		__cpuid(1, eax, ebx, ecx, edx);
 		if (ecx & BASE64_bit_SSSE3) {
-			codec->enc = base64_stream_encode_ssse3;
-			codec->dec = base64_stream_decode_ssse3;
-			return true;
+			return &base64_codec_ssse3;
 		}
 	}
 	#endif
 
-#else
-	(void)codec;
 #endif
 
-	return false;
+	return NULL;
 }
 
-void
-base64_codec_choose (struct base64_codec *codec, int flags)
+const struct base64_codec *
+base64_codec_choose (int flags)
 {
+	const struct base64_codec *codec;
+
 	// User forced a codec:
-	if (codec_choose_forced(codec, flags)) {
-		return;
+	if ((codec = codec_choose_forced(flags)) != NULL) {
+		return codec;
 	}
 
-	// Runtime feature detection:
-	if (codec_choose_arm(codec)) {
-		return;
+	// Runtime feature detection, done once:
+	if ((codec = BASE64_LOAD_CODEC(base64_codec_detected)) != NULL) {
+		return codec;
 	}
-	if (codec_choose_x86(codec)) {
-		return;
+	if ((codec = codec_choose_arm()) == NULL &&
+	    (codec = codec_choose_x86()) == NULL) {
+		codec = &base64_codec_plain;
 	}
-	codec->enc = base64_stream_encode_plain;
-	codec->dec = base64_stream_decode_plain;
+	BASE64_STORE_CODEC(base64_codec_detected, codec);
+	return codec;
 }
+
+#if defined(__GNUC__) || defined(__clang__)
+// Run the feature detection when the library is loaded, so that it is not
+// part of the first call. Other compilers detect on first use:
+__attribute__((constructor)) static void
+codec_detect_at_load (void)
+{
+	base64_codec_choose(0);
+}
+#endif
@@ -25,10 +25,172 @@
     BASE64_UNUSED(outlen);             \
     return -1;
 
+// Stub function when span arch unsupported. Returning zero leaves all of the
+// input to the caller's bytewise code:
+#define BASE64_SPAN_STUB               \
+    BASE64_UNUSED(state);              \
+    BASE64_UNUSED(src);                \
+    BASE64_UNUSED(srclen);             \
+    return 0;
+
+// Stub function when the ignore loop of an arch is unsupported:
+#define BASE64_DEC_IGNORE_STUB         \
+    BASE64_UNUSED(state);              \
+    BASE64_UNUSED(set);                \
+    BASE64_UNUSED(src);                \
+    BASE64_UNUSED(srclen);             \
+    BASE64_UNUSED(out);                \
+    BASE64_UNUSED(pending);            \
+    BASE64_UNUSED(npending);           \
+    *outlen = 0;                       \
+    return 0;
+
+// Stub function when the wrapping encoder loop of an arch is unsupported:
+#define BASE64_ENC_WRAP_STUB           \
+    BASE64_UNUSED(state);              \
+    BASE64_UNUSED(src);                \
+    BASE64_UNUSED(srclen);             \
+    BASE64_UNUSED(out);                \
+    *outlen = 0;                       \
+    return 0;
+
+// Count the trailing zero bits of a nonzero mask, to find the position of the
+// first flagged byte in a SIMD comparison result, and count the set bits:
+#ifdef _MSC_VER
+#include <intrin.h>
+static inline unsigned int
+base64_ctz32 (uint32_t x)
+{
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (unsigned int) i;
+}
+#ifdef _M_X64
+static inline unsigned int
+base64_ctz64 (uint64_t x)
+{
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (unsigned int) i;
+}
+#define base64_popcount64(x)    ((unsigned int) __popcnt64(x))
+#endif
+#else
+#define base64_ctz32(x)         ((unsigned int) __builtin_ctz(x))
+#define base64_ctz64(x)         ((unsigned int) __builtin_ctzll(x))
+#define base64_popcount64(x)    ((unsigned int) __builtin_popcountll(x))
+#endif
+
+// Check whether the decoding policy in `flags` allows padding at the current
+// position of a quantum, after its second or third character. The unused bits
+// of that character are left in `carry`. The policy is only checked here and
+// at the end of the input, never in the SIMD loops:
+static inline int
+base64_pad_allowed (int flags, unsigned char carry)
+{
+    if (flags & BASE64_FORBID_PAD) {
+        return 0;
+    }
+    return !(flags & BASE64_STRICT) || carry == 0;
+}
+
+// The input length of a call from which the SIMD encoders write their output
+// with non-temporal stores even without BASE64_NONTEMPORAL. The output is
+// then larger than a typical last-level cache, so that it would only evict
+// the input that is still to be read:
+#define BASE64_NONTEMPORAL_SIZE (16 * 1024 * 1024)
+
+static inline int
+base64_enc_nontemporal (int flags, size_t srclen)
+{
+    return (flags & BASE64_NONTEMPORAL) || srclen >= BASE64_NONTEMPORAL_SIZE;
+}
+
+// Kernels of the fixed-width functions, such as base64_encode_16(), for 16,
+// 20, 32, 48 and 64 bytes in that order:
+struct base64_fixed
+{
+    void (* enc[5]) (const char *src, char *out, int flags);
+    int  (* dec[5]) (const char *src, char *out, int flags);
+};
+
+struct base64_ignore_set;
+
 struct base64_codec
 {
-    void (* enc) (struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
-    int  (* dec) (struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+    void   (* enc)  (struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+    int    (* dec)  (struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
+    size_t (* span) (const struct base64_state *state, const char *src, size_t srclen);
+
+    // The largest inputs that one-shot calls encode and decode faster on
+    // the short path of lib_small.c than with this codec. The first is in
+    // bytes of plain data, the second in characters of encoded data:
+    size_t small_enc;
+    size_t small_dec;
+
+    // The fixed-width kernels of this codec, or NULL if it has none, in
+    // which case the short path serves those functions:
+    const struct base64_fixed *fixed;
+
+    // Decode from a quad boundary while skipping the bytes of an ignore set
+    // in the SIMD loop, or NULL if the codec has no such loop. The first
+    // `*npending` characters in `pending`, which has room for 64, come
+    // before the input. Returns the number of input bytes consumed, and
+    // leaves the characters that were consumed but not decoded in
+    // `pending`. The loop stops at anything but whole blocks of characters
+    // and skipped bytes, and lib.c takes over from there:
+    size_t (* dec_ignore) (struct base64_state *state, const struct base64_ignore_set *set, const char *src, size_t srclen, char *out, size_t *outlen, uint8_t *pending, size_t *npending);
+
+    // Encode from a quad boundary while breaking the lines of the output in
+    // the SIMD loop, or NULL if the codec has no such loop. Lines are at
+    // least 16 characters wide, and the column is kept in the state. Returns
+    // the number of input bytes consumed, a multiple of three. The loop
+    // stops short of the end of the input, and lib.c takes over from there:
+    size_t (* enc_wrap) (struct base64_state *state, const char *src, size_t srclen, char *out, size_t *outlen);
 };
 
-extern void base64_codec_choose (struct base64_codec *, int flags);
\ No newline at end of file
+extern const struct base64_codec base64_codec_avx512;
+extern const struct base64_codec base64_codec_avx512_vbmi2;
+extern const struct base64_codec base64_codec_avx2;
+extern const struct base64_codec base64_codec_neon32;
+extern const struct base64_codec base64_codec_neon64;
+extern const struct base64_codec base64_codec_plain;
+extern const struct base64_codec base64_codec_ssse3;
+extern const struct base64_codec base64_codec_sse41;
+extern const struct base64_codec base64_codec_sse42;
+extern const struct base64_codec base64_codec_avx;
+
+extern const struct base64_fixed base64_fixed_avx512;
+extern const struct base64_fixed base64_fixed_avx2;
+extern const struct base64_fixed base64_fixed_ssse3;
+extern const struct base64_fixed base64_fixed_sse41;
+extern const struct base64_fixed base64_fixed_sse42;
+extern const struct base64_fixed base64_fixed_avx;
+
+extern const struct base64_codec *base64_codec_choose (int flags);
+
+// The codec found by the runtime feature detection, or NULL before it ran.
+// Atomic accesses keep the once-only initialization well-defined:
+extern const struct base64_codec *base64_codec_detected;
+
+#if defined(__GNUC__) || defined(__clang__)
+# define BASE64_LOAD_CODEC(p)		__atomic_load_n(&(p), __ATOMIC_RELAXED)
+# define BASE64_STORE_CODEC(p, v)	__atomic_store_n(&(p), (v), __ATOMIC_RELAXED)
+#else
+// MSVC treats aligned pointer-sized volatile accesses as atomic:
+# define BASE64_LOAD_CODEC(p)		(*(const struct base64_codec *volatile *) &(p))
+# define BASE64_STORE_CODEC(p, v)	(*(const struct base64_codec *volatile *) &(p) = (v))
+#endif
+
+// Choose the codec for a new state. Without codec flags this is a single load
+// of the detected codec, which is in place from load time:
+static inline const struct base64_codec *
+base64_codec_get (int flags)
+{
+    const struct base64_codec *codec = BASE64_LOAD_CODEC(base64_codec_detected);
+
+    if (codec == NULL || flags & 0xFFFF) {
+        return base64_codec_choose(flags);
+    }
+    return codec;
+}
\ No newline at end of file
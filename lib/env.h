@@ -71,4 +71,33 @@
 #  define BASE64_FALLTHROUGH
 #endif
 
+// Force a function inline, such as a loop that is instantiated once for each
+// of two targets, or keep it out of line, so that the registers of a variant
+// of a loop are allocated apart from those of the other:
+#if defined(__GNUC__) || defined(__clang__)
+#  define BASE64_FORCE_INLINE  inline __attribute__((always_inline))
+#  define BASE64_NOINLINE      __attribute__((noinline))
+#elif defined(_MSC_VER)
+#  define BASE64_FORCE_INLINE  __forceinline
+#  define BASE64_NOINLINE      __declspec(noinline)
+#else
+#  define BASE64_FORCE_INLINE  inline
+#  define BASE64_NOINLINE
+#endif
+
+// The AVX512 codec is built for AVX512-VBMI. Its loops for AVX512-VBMI2 are
+// compiled with a function attribute instead, so that the rest of the codec
+// still runs on CPUs without it. MSVC takes the intrinsics as they are:
+#if defined(__clang__)
+#  if __clang_major__ >= 6
+#    define BASE64_VBMI2_TARGET  __attribute__((target("avx512vbmi2,popcnt")))
+#  endif
+#elif defined(__GNUC__)
+#  if __GNUC__ >= 8
+#    define BASE64_VBMI2_TARGET  __attribute__((target("avx512vbmi2,popcnt")))
+#  endif
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define BASE64_VBMI2_TARGET
+#endif
+
 #endif	// BASE64_ENV_H
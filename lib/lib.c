@@ -1,5 +1,19 @@
+#if BASE64_HAVE_PTHREADS
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+// For the NUMA topology and the thread affinity of the pool:
+#define _GNU_SOURCE
+#elif !defined(_POSIX_C_SOURCE)
+// For sysconf() and clock_gettime() in strict C99 mode:
+#define _POSIX_C_SOURCE 200112L
+#endif
+#endif
+
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -9,26 +23,145 @@
 #include "codecs.h"
 #include "env.h"
 
-// These static function pointers are initialized once when the library is
-// first used, and remain in use for the remaining lifetime of the program.
-// The idea being that CPU features don't change at runtime.
-static struct base64_codec g_base64_codec = { NULL, NULL };
+// The opaque storage of a custom alphabet must be large enough to hold its
+// tables:
+typedef char base64_alphabet_size_check
+	[(sizeof (struct base64_alphabet) >= sizeof (struct base64_tables_custom)) ? 1 : -1];
 
-void
-base64_stream_encode_init (struct base64_state *state, int flags)
+// Likewise for an ignore set:
+typedef char base64_ignore_size_check
+	[(sizeof (struct base64_ignore) >= sizeof (struct base64_ignore_set)) ? 1 : -1];
+
+// Each state keeps its own codec, so that states with different codec flags
+// can be used side by side:
+static inline void
+base64_state_init (struct base64_state *state, int flags, const struct base64_codec *codec)
 {
-	// If any of the codec flags are set, redo choice:
-	if (g_base64_codec.enc == NULL || flags & 0xFF) {
-		base64_codec_choose(&g_base64_codec, flags);
-	}
+	state->codec = codec;
 	state->eof = 0;
 	state->bytes = 0;
 	state->carry = 0;
 	state->flags = flags;
+	state->alphabet = NULL;
+	state->ignore = NULL;
+	state->ignore_bytes = 0;
+	state->wrap = 0;
+	state->wrap_col = 0;
+	state->wrap_crlf = 0;
+	state->threads = 1;
 }
 
+#if BASE64_HAVE_PTHREADS
+// The multi-threaded stream functions of lib_threads.c:
+static void base64_stream_encode_threads (struct base64_state *, const char *, size_t, char *, size_t *);
+static int base64_stream_decode_threads (struct base64_state *, const char *, size_t, char *, size_t *);
+#endif
+
 void
-base64_stream_encode
+base64_stream_encode_init (struct base64_state *state, int flags)
+{
+	base64_state_init(state, flags, base64_codec_get(flags));
+}
+
+// Copy a line of `len` bytes, where `len` is at least 16, in blocks of 16
+// bytes. The last block may overlap the one before it. Fixed-size copies
+// compile to single loads and stores:
+static inline void
+base64_wrap_line (char *out, const char *src, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i + 16 < len; i += 16) {
+		memcpy(out + i, src + i, 16);
+	}
+	memcpy(out + len - 16, src + len - 16, 16);
+}
+
+// Copy `len` encoded characters from `src` to `out`, breaking the lines at the
+// configured width. Returns the new output position. The line state is kept
+// in local variables, because the compiler cannot tell that the output does
+// not overlap the state:
+static inline char *
+base64_wrap_copy
+	( struct base64_state	*state
+	, const char		*src
+	, size_t		 len
+	, char			*out
+	)
+{
+	const size_t wrap = state->wrap;
+	const int crlf = state->wrap_crlf;
+	size_t col = state->wrap_col;
+
+	while (len > 0) {
+		size_t n = wrap - col;
+
+		// Break the line before the first character that does not
+		// fit, so that the output never ends in a line break:
+		if (n == 0) {
+			if (crlf) {
+				*out++ = '\r';
+			}
+			*out++ = '\n';
+
+			// Copy the whole lines that follow:
+			if (wrap >= 16 && len > wrap) {
+				base64_wrap_line(out, src, wrap);
+				out += wrap;
+				src += wrap;
+				len -= wrap;
+				continue;
+			}
+			col = 0;
+			n = wrap;
+		}
+		if (n > len) {
+			n = len;
+		}
+		memcpy(out, src, n);
+		col += n;
+		out += n;
+		src += n;
+		len -= n;
+	}
+	state->wrap_col = col;
+	return out;
+}
+
+// Encode with line wrapping through a buffer on the stack, for the codecs and
+// the input that the SIMD loops leave over. The input is encoded one chunk at
+// a time by the codec, and the lines are then copied out of the buffer while
+// it is still in the cache. Each chunk of input is a multiple of three bytes,
+// which encodes to exactly four characters per three bytes. Returns the new
+// output position:
+static char *
+base64_stream_encode_wrap_buf
+	( struct base64_state	*state
+	, const char		*src
+	, size_t		 srclen
+	, char			*out
+	)
+{
+	char buf[4096];
+
+	while (srclen > 0) {
+		const size_t chunk = (srclen < sizeof (buf) / 4 * 3) ? srclen : sizeof (buf) / 4 * 3;
+		size_t len;
+
+		state->codec->enc(state, src, chunk, buf, &len);
+		out = base64_wrap_copy(state, buf, len, out);
+
+		src    += chunk;
+		srclen -= chunk;
+	}
+	return out;
+}
+
+// Encode with line wrapping. Codecs with a wrapping SIMD loop break the lines
+// as they store the output, from a quad boundary, so the bytes that complete
+// the quad of the carry go through the buffer first:
+static void
+base64_stream_encode_wrap
 	( struct base64_state	*state
 	, const char		*src
 	, size_t		 srclen
@@ -36,45 +169,570 @@ base64_stream_encode
 	, size_t		*outlen
 	)
 {
-	g_base64_codec.enc(state, src, srclen, out, outlen);
+	char *o = out;
+
+	if (state->codec->enc_wrap != NULL && state->wrap >= 16) {
+		if (state->bytes != 0) {
+			const size_t n = (srclen < 3 - (size_t) state->bytes) ? srclen : 3 - (size_t) state->bytes;
+
+			o = base64_stream_encode_wrap_buf(state, src, n, o);
+			src    += n;
+			srclen -= n;
+		}
+		if (state->bytes == 0) {
+			size_t len;
+			const size_t n = state->codec->enc_wrap(state, src, srclen, o, &len);
+
+			o      += len;
+			src    += n;
+			srclen -= n;
+		}
+	}
+	o = base64_stream_encode_wrap_buf(state, src, srclen, o);
+	*outlen = (size_t) (o - out);
 }
 
 void
-base64_stream_encode_final
+base64_stream_encode
 	( struct base64_state	*state
+	, const char		*src
+	, size_t		 srclen
 	, char			*out
 	, size_t		*outlen
 	)
 {
-	uint8_t *o = (uint8_t *)out;
+	if (state->wrap > 0) {
+		base64_stream_encode_wrap(state, src, srclen, out, outlen);
+		return;
+	}
+#if BASE64_HAVE_PTHREADS
+	if (state->threads != 1) {
+		base64_stream_encode_threads(state, src, srclen, out, outlen);
+		return;
+	}
+#endif
+	state->codec->enc(state, src, srclen, out, outlen);
+}
+
+// Write the trailer of the output at `out`: the carry, followed by the end-of-
+// stream markers unless padding was disabled or the alphabet has none. Returns
+// the number of bytes written, at most three:
+static inline size_t
+base64_encode_trailer (const struct base64_state *state, uint8_t *out)
+{
+	const struct base64_tables *tables = base64_tables_choose(state);
+	const int pad = !(state->flags & (BASE64_NOPAD | BASE64_FORBID_PAD)) && tables->pad != 0;
+	uint8_t *o = out;
 
 	if (state->bytes == 1) {
-		*o++ = base64_table_enc_6bit[state->carry];
-		*o++ = '=';
-		*o++ = '=';
-		*outlen = 3;
-		return;
+		*o++ = tables->enc_6bit[state->carry];
+		if (pad) {
+			*o++ = tables->pad;
+			*o++ = tables->pad;
+		}
 	}
 	if (state->bytes == 2) {
-		*o++ = base64_table_enc_6bit[state->carry];
-		*o++ = '=';
-		*outlen = 2;
+		*o++ = tables->enc_6bit[state->carry];
+		if (pad) {
+			*o++ = tables->pad;
+		}
+	}
+	return (size_t) (o - out);
+}
+
+void
+base64_stream_encode_final
+	( struct base64_state	*state
+	, char			*out
+	, size_t		*outlen
+	)
+{
+	uint8_t tail[3];
+	char *end;
+
+	// Without wrapping, the trailer goes out as it is:
+	if (state->wrap == 0) {
+		*outlen = base64_encode_trailer(state, (uint8_t *) out);
 		return;
 	}
-	*outlen = 0;
+
+	// Otherwise it goes through the line breaking, and the last line is
+	// ended:
+	end = base64_wrap_copy(state, (const char *) tail, base64_encode_trailer(state, tail), out);
+
+	if (state->wrap_col > 0) {
+		if (state->wrap_crlf) {
+			*end++ = '\r';
+		}
+		*end++ = '\n';
+		state->wrap_col = 0;
+	}
+	*outlen = (size_t) (end - out);
+}
+
+void
+base64_stream_set_wrap
+	( struct base64_state	*state
+	, size_t		 cols
+	, int			 crlf
+	)
+{
+	state->wrap = cols;
+	state->wrap_col = 0;
+	state->wrap_crlf = crlf;
+}
+
+void
+base64_stream_set_threads (struct base64_state *state, int nthreads)
+{
+	state->threads = nthreads;
 }
 
 void
 base64_stream_decode_init (struct base64_state *state, int flags)
 {
-	// If any of the codec flags are set, redo choice:
-	if (g_base64_codec.dec == NULL || flags & 0xFFFF) {
-		base64_codec_choose(&g_base64_codec, flags);
+	base64_state_init(state, flags, base64_codec_get(flags));
+}
+
+// The candidates of an ignore set are found by scanning the input a block at
+// a time. With SSE2, which is part of the x86-64 baseline and needs no runtime
+// detection, a block is 16 bytes. Elsewhere it is a 64-bit word. The ranges of
+// the set are turned into constants once per call, and padded with empty
+// ranges to a count of 1, 2 or 4. The scan is compiled for each of these
+// counts, so that the loop over the ranges unrolls. Both versions copy the
+// block to `dst` on the way, and return a nonzero value if any of its bytes is
+// a candidate:
+#if defined(__SSE2__) || defined(_M_X64)
+
+#define BASE64_IGNORE_BLOCK 16
+
+struct base64_ignore_scanner {
+	int nranges;
+	__m128i below[BASE64_IGNORE_RANGES];
+	__m128i above[BASE64_IGNORE_RANGES];
+	__m128i high;
+};
+
+static inline void
+base64_ignore_scanner_init
+	( struct base64_ignore_scanner		*scanner
+	, const struct base64_ignore_set	*set
+	)
+{
+	int i;
+
+	// The signed comparisons treat bytes above 127 as negative, which
+	// puts them below all ranges. They are caught by their high bit. No
+	// byte is greater than 127, which makes for an empty range:
+	scanner->nranges = (set->nranges <= 2) ? 1 + (set->nranges == 2) : 4;
+	for (i = 0; i < scanner->nranges; i++) {
+		scanner->below[i] = _mm_set1_epi8((char) (i < set->nranges ? set->lo[i] - 1 : 127));
+		scanner->above[i] = _mm_set1_epi8((char) (i < set->nranges ? set->hi[i] : 127));
 	}
-	state->eof = 0;
-	state->bytes = 0;
-	state->carry = 0;
-	state->flags = flags;
+	scanner->high = _mm_set1_epi8((char) (set->high ? 0x80 : 0));
+}
+
+static inline uint32_t
+base64_ignore_block
+	( const struct base64_ignore_scanner	*scanner
+	, const int				 nranges
+	, const uint8_t				*src
+	, uint8_t				*dst
+	)
+{
+	const __m128i x = _mm_loadu_si128((const __m128i *) src);
+	__m128i hits = _mm_and_si128(x, scanner->high);
+	int i;
+
+	_mm_storeu_si128((__m128i *) dst, x);
+
+	for (i = 0; i < nranges; i++) {
+		hits = _mm_or_si128(hits, _mm_andnot_si128(
+			_mm_cmpgt_epi8(x, scanner->above[i]),
+			_mm_cmpgt_epi8(x, scanner->below[i])));
+	}
+
+	// One bit per byte, set for the candidates:
+	return (uint32_t) _mm_movemask_epi8(hits);
+}
+
+#else
+
+#define BASE64_IGNORE_BLOCK 8
+
+struct base64_ignore_scanner {
+	int nranges;
+	uint64_t below[BASE64_IGNORE_RANGES];
+	uint64_t above[BASE64_IGNORE_RANGES];
+	uint64_t high;
+};
+
+static inline void
+base64_ignore_scanner_init
+	( struct base64_ignore_scanner		*scanner
+	, const struct base64_ignore_set	*set
+	)
+{
+	const uint64_t ones = UINT64_C(0x0101010101010101);
+	int i;
+
+	// A lower bound of 128 makes for an empty range:
+	scanner->nranges = (set->nranges <= 2) ? 1 + (set->nranges == 2) : 4;
+	for (i = 0; i < scanner->nranges; i++) {
+		scanner->below[i] = ones * (i < set->nranges ? 128 - set->lo[i] : 0);
+		scanner->above[i] = ones * (i < set->nranges ? 128 + set->hi[i] : 128);
+	}
+	scanner->high = set->high ? ones * 128 : 0;
+}
+
+static inline uint32_t
+base64_ignore_block
+	( const struct base64_ignore_scanner	*scanner
+	, const int				 nranges
+	, const uint8_t				*src
+	, uint8_t				*dst
+	)
+{
+	// Check whether any byte of the word lies within one of the ranges.
+	// This is exact for 0 < lo <= hi < 128, see "Determine if a word has
+	// a byte between m and n" in Sean Eron Anderson's Bit Twiddling Hacks:
+	const uint64_t ones = UINT64_C(0x0101010101010101);
+	uint64_t x, low7, hits;
+	int i;
+
+	memcpy(&x, src, sizeof (x));
+	memcpy(dst, &x, sizeof (x));
+
+	low7 = x & (ones * 127);
+	hits = x & scanner->high;
+
+	for (i = 0; i < nranges; i++) {
+		hits |= (scanner->above[i] - low7) & ~x & (low7 + scanner->below[i]);
+	}
+	return (hits & (ones * 128)) != 0;
+}
+
+#endif
+
+// Copy bytes from `src` to `dst` up to the first candidate, and return its
+// offset (or `srclen` if there is none):
+static inline size_t
+base64_ignore_scan
+	( const struct base64_ignore_scanner	*scanner
+	, const int				 nranges
+	, const struct base64_ignore_set	*set
+	, const uint8_t				*src
+	, size_t				 srclen
+	, uint8_t				*dst
+	)
+{
+	size_t i = 0;
+
+	while (i + BASE64_IGNORE_BLOCK <= srclen && base64_ignore_block(scanner, nranges, src + i, dst + i) == 0) {
+		i += BASE64_IGNORE_BLOCK;
+	}
+	for (; i < srclen; i++) {
+		if (set->table[src[i]]) {
+			break;
+		}
+		dst[i] = src[i];
+	}
+	return i;
+}
+
+// Copy a line of `len` bytes from `src` to `dst`, where `len` is at least one
+// block. Returns nonzero if any of its bytes is a candidate. The last block
+// may overlap the one before it. Because the hits of all blocks are merged,
+// this takes one predictable branch per line:
+static inline uint32_t
+base64_ignore_line
+	( const struct base64_ignore_scanner	*scanner
+	, const int				 nranges
+	, const uint8_t				*src
+	, size_t				 len
+	, uint8_t				*dst
+	)
+{
+	uint32_t hits = 0;
+	size_t i;
+
+	for (i = 0; i + BASE64_IGNORE_BLOCK < len; i += BASE64_IGNORE_BLOCK) {
+		hits |= base64_ignore_block(scanner, nranges, src + i, dst + i);
+	}
+	i = len - BASE64_IGNORE_BLOCK;
+
+	return hits | base64_ignore_block(scanner, nranges, src + i, dst + i);
+}
+
+// Copy bytes from `src` to `dst`, leaving out the bytes and sequences in the
+// set. Stops after the first `chunk` bytes of input, but sequences may extend
+// up to `srclen`. Returns the number of bytes copied, which is at most
+// `chunk`, and sets `*used` to the number of input bytes consumed. If the
+// input ends in the middle of a sequence, its first bytes are held back in
+// the state. Most input is either free of ignored bytes or wrapped in lines of
+// a fixed length. The scan copies the first in blocks, and once it has seen a
+// complete line, it copies the following lines whole as long as they have the
+// same length and the same line break:
+static inline size_t
+base64_ignore_compact
+	( struct base64_state			*state
+	, const struct base64_ignore_set	*set
+	, const struct base64_ignore_scanner	*scanner
+	, const int				 nranges
+	, const uint8_t				*src
+	, size_t				 chunk
+	, size_t				 srclen
+	, uint8_t				*dst
+	, size_t				*used
+	)
+{
+	size_t i = 0, n = 0;
+
+	while (i < chunk) {
+		const size_t start = i;
+		size_t line, brk;
+		uint64_t mask, prev;
+		int open = 0;
+		uint8_t bytes[8] = { 0 };
+
+		// Copy the bytes up to the next candidate:
+		i += base64_ignore_scan(scanner, nranges, set, src + i, chunk - i, dst + n);
+		n += i - start;
+		line = i - start;
+
+		// Skip the bytes and sequences in the set that follow:
+		for (; i < srclen; i++) {
+			const uint8_t c = set->table[src[i]];
+
+			if (c & BASE64_IGNORE_SEQ) {
+				const int len = base64_ignore_match(set, src + i, srclen - i);
+
+				if (len > 0) {
+					i += (size_t) len - 1;
+					continue;
+				}
+				if (len < 0) {
+					memcpy(state->ignore_carry, src + i, srclen - i);
+					state->ignore_bytes = (int) (srclen - i);
+					i = srclen;
+					break;
+				}
+				open = 1;
+			}
+			if (!(c & BASE64_IGNORE_BYTE)) {
+				break;
+			}
+		}
+		brk = i - start - line;
+
+		// A candidate that is not in the set is kept:
+		if (brk == 0) {
+			if (i < chunk) {
+				dst[n++] = src[i++];
+			}
+			continue;
+		}
+
+		// Copy the lines that follow while they match this one. The
+		// line breaks are compared eight bytes at a time, masked to
+		// their length. A break in which a sequence did not match may
+		// hold the start of one when followed by other bytes, so it is
+		// not repeated:
+		if (line < BASE64_IGNORE_BLOCK || brk > 8 || open || i + line + 8 > chunk) {
+			continue;
+		}
+		memset(bytes, 0xFF, brk);
+		memcpy(&mask, bytes, sizeof (mask));
+		memcpy(&prev, src + i - brk, sizeof (prev));
+
+		while (i + line + 8 <= chunk && base64_ignore_line(scanner, nranges, src + i, line, dst + n) == 0) {
+			uint64_t next;
+
+			memcpy(&next, src + i + line, sizeof (next));
+			if ((next ^ prev) & mask) {
+				break;
+			}
+			n += line;
+			i += line + brk;
+		}
+	}
+	*used = i;
+	return n;
+}
+
+// Resolve the bytes that were held back at the end of the previous call, now
+// that the input continues. They are either skipped or copied to `dst`.
+// Returns the number of bytes copied, and advances `*src` past the bytes that
+// completed a sequence:
+static size_t
+base64_ignore_resume
+	( struct base64_state			*state
+	, const struct base64_ignore_set	*set
+	, const uint8_t				**src
+	, size_t				*srclen
+	, uint8_t				*dst
+	)
+{
+	uint8_t tmp[2 * BASE64_IGNORE_SEQLEN];
+	const size_t held = (size_t) state->ignore_bytes;
+	const size_t more = (*srclen < BASE64_IGNORE_SEQLEN) ? *srclen : BASE64_IGNORE_SEQLEN;
+	const size_t len = held + more;
+	size_t i = 0, n = 0;
+
+	memcpy(tmp, state->ignore_carry, held);
+	memcpy(tmp + held, *src, more);
+	state->ignore_bytes = 0;
+
+	while (i < held) {
+		const uint8_t c = set->table[tmp[i]];
+
+		if (c & BASE64_IGNORE_SEQ) {
+			const int r = base64_ignore_match(set, tmp + i, len - i);
+
+			if (r > 0) {
+				i += (size_t) r;
+				continue;
+			}
+
+			// Still in the middle of a sequence. This means that
+			// `tmp` holds all of the input, so hold it back again:
+			if (r < 0) {
+				memcpy(state->ignore_carry, tmp + i, len - i);
+				state->ignore_bytes = (int) (len - i);
+				i = len;
+				break;
+			}
+		}
+		if (c & BASE64_IGNORE_BYTE) {
+			i++;
+			continue;
+		}
+		dst[n++] = tmp[i++];
+	}
+	if (i > held) {
+		*src    += i - held;
+		*srclen -= i - held;
+	}
+	return n;
+}
+
+// The most input that is compacted at a time after the SIMD loop of a codec
+// stopped. The loop stops at a block of up to 64 bytes that it cannot handle,
+// and picks up again after it:
+#define BASE64_IGNORE_FALLBACK 64
+
+// Check whether the codec can take over the characters in `buf` from a quad
+// boundary, which it only does for valid characters:
+static inline int
+base64_ignore_handover
+	( const struct base64_state	*state
+	, const uint8_t			*buf
+	, size_t			 len
+	)
+{
+	const struct base64_tables *tables = base64_tables_choose(state);
+	size_t i;
+
+	if (state->bytes != 0 || state->eof || state->ignore_bytes > 0 || len > 3) {
+		return 0;
+	}
+	for (i = 0; i < len; i++) {
+		if (tables->dec_8bit[buf[i]] >= 64) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// Decode while skipping the bytes and sequences in the set. Codecs with a
+// SIMD loop for this skip both in that loop, from a quad boundary. Where
+// that loop stops, and for all input of the other codecs, the input is
+// compacted into a buffer on the stack one chunk at a time and then handed to
+// the codec. Quads that straddle chunks are carried over in the stream state
+// as usual, except that the characters past the last quad boundary are held
+// back in the buffer for the SIMD loop:
+static int
+base64_stream_decode_ignore
+	( struct base64_state			*state
+	, const struct base64_ignore_set	*set
+	, const char				*src
+	, size_t				 srclen
+	, char					*out
+	, size_t				*outlen
+	)
+{
+	struct base64_ignore_scanner scanner;
+	uint8_t buf[4096];
+	const uint8_t *s = (const uint8_t *) src;
+	const struct base64_codec *codec = state->codec;
+	size_t len = 0;
+	int ret = 1;
+
+	*outlen = 0;
+
+	if (state->ignore_bytes > 0) {
+		len = base64_ignore_resume(state, set, &s, &srclen, buf);
+	}
+	base64_ignore_scanner_init(&scanner, set);
+
+	while (srclen > 0 || len > 0) {
+		size_t chunk = sizeof (buf) - len;
+		size_t used, olen, hold = 0;
+
+		if (codec->dec_ignore != NULL && base64_ignore_handover(state, buf, len)) {
+			used = codec->dec_ignore(state, set, (const char *) s, srclen, out + *outlen, &olen, buf, &len);
+			s       += used;
+			srclen  -= used;
+			*outlen += olen;
+
+			// If the loop made progress, it stopped at a block that
+			// it cannot handle. Compact just past that block:
+			if (used > 0 && chunk > BASE64_IGNORE_FALLBACK) {
+				chunk = BASE64_IGNORE_FALLBACK;
+			}
+		}
+		if (chunk > srclen) {
+			chunk = srclen;
+		}
+
+		// Pick the scan for the number of ranges:
+		switch (scanner.nranges) {
+		case 1:
+			len += base64_ignore_compact(state, set, &scanner, 1, s, chunk, srclen, buf + len, &used);
+			break;
+		case 2:
+			len += base64_ignore_compact(state, set, &scanner, 2, s, chunk, srclen, buf + len, &used);
+			break;
+		default:
+			len += base64_ignore_compact(state, set, &scanner, 4, s, chunk, srclen, buf + len, &used);
+			break;
+		}
+		s      += used;
+		srclen -= used;
+
+		// Skip chunks that held only ignored bytes, the codec would
+		// flag them as an error after the end of the stream:
+		if (len == 0) {
+			continue;
+		}
+
+		// Hold back the characters past the last quad boundary for
+		// the SIMD loop, if there is more input:
+		if (codec->dec_ignore != NULL && srclen > 0 && state->eof == 0) {
+			hold = ((size_t) state->bytes + len) % 4;
+		}
+
+		ret = codec->dec(state, (const char *) buf, len - hold, out + *outlen, &olen);
+		*outlen += olen;
+
+		memmove(buf, buf + len - hold, hold);
+		len = hold;
+
+		if (ret != 1) {
+			break;
+		}
+	}
+	return ret;
 }
 
 int
@@ -86,19 +744,186 @@ base64_stream_decode
 	, size_t		*outlen
 	)
 {
-	return g_base64_codec.dec(state, src, srclen, out, outlen);
+	if (state->ignore != NULL) {
+		return base64_stream_decode_ignore(state, (const struct base64_ignore_set *) state->ignore, src, srclen, out, outlen);
+	}
+	if (state->flags & BASE64_IGNORE_SPACE) {
+		return base64_stream_decode_ignore(state, &base64_ignore_space, src, srclen, out, outlen);
+	}
+	if (state->flags & BASE64_FORGIVING) {
+		return base64_stream_decode_ignore(state, &base64_ignore_forgiving, src, srclen, out, outlen);
+	}
+#if BASE64_HAVE_PTHREADS
+	if (state->threads != 1) {
+		return base64_stream_decode_threads(state, src, srclen, out, outlen);
+	}
+#endif
+	return state->codec->dec(state, src, srclen, out, outlen);
+}
+
+void
+base64_stream_set_alphabet
+	( struct base64_state		*state
+	, const struct base64_alphabet	*alphabet
+	)
+{
+	state->alphabet = alphabet;
+}
+
+int
+base64_alphabet_init
+	( struct base64_alphabet	*alphabet
+	, const char			*chars
+	, char				 pad
+	)
+{
+	return base64_tables_generate((struct base64_tables_custom *) alphabet, (const uint8_t *) chars, (uint8_t) pad);
+}
+
+void
+base64_stream_set_ignore
+	( struct base64_state		*state
+	, const struct base64_ignore	*ignore
+	)
+{
+	state->ignore = ignore;
+}
+
+int
+base64_ignore_init
+	( struct base64_ignore	*ignore
+	, const char		*bytes
+	, const char *const	*seqs
+	)
+{
+	return base64_ignore_generate((struct base64_ignore_set *) ignore, bytes, seqs);
+}
+
+// Check whether the decoding policy lets the input end without padding:
+static inline int
+base64_pad_optional (int flags, const struct base64_tables *tables)
+{
+	return (flags & (BASE64_NOPAD | BASE64_FORGIVING | BASE64_FORBID_PAD)) || tables->pad == 0;
+}
+
+// Check whether a decoder state is at a valid end of the input. Without
+// padding, the input may also end after the second or third character of a
+// quantum, if the unused bits of that character pass the policy:
+static inline int
+base64_stream_decode_complete (const struct base64_state *state)
+{
+	// The input must not end in the middle of an ignored sequence:
+	if (state->ignore_bytes != 0) {
+		return 0;
+	}
+	if (state->bytes == 0) {
+		return 1;
+	}
+	if (base64_pad_optional(state->flags, base64_tables_choose(state))) {
+		return state->eof == 0 && state->bytes >= 2
+		    && (!(state->flags & BASE64_STRICT) || state->carry == 0);
+	}
+	return 0;
 }
 
 #ifdef _OPENMP
 
-	// Due to the overhead of initializing OpenMP and creating a team of
-	// threads, we require the data length to be larger than a threshold:
-	#define OMP_THRESHOLD 20000
+	// The parallel decoder works in blocks, between which it checks
+	// whether another thread found an error:
+	#define OMP_BLOCK 65536
 
 	// Conditionally include OpenMP-accelerated codec implementations:
 	#include "lib_openmp.c"
 #endif
 
+#if BASE64_WORDSIZE >= 32
+
+	// Conditionally include the short path for tiny inputs:
+	#include "lib_small.c"
+#endif
+
+// Include the batch functions, which gather small buffers for the codecs:
+#include "lib_batch.c"
+
+// Include the scatter/gather functions:
+#include "lib_iovec.c"
+
+#if BASE64_HAVE_PTHREADS
+
+	// Include the thread pool:
+	#include "lib_pool.c"
+#endif
+
+#if defined(_OPENMP) || BASE64_HAVE_PTHREADS
+
+	// Due to the overhead of waking up threads and waiting for them, the
+	// data length must be larger than a threshold, which is calibrated:
+	#include "lib_parallel.c"
+#else
+
+void
+base64_set_parallel_threshold (size_t srclen)
+{
+	BASE64_UNUSED(srclen);
+}
+#endif
+
+#if BASE64_HAVE_PTHREADS
+
+	// Include the multi-threaded functions:
+	#include "lib_threads.c"
+#else
+
+// Without threads, the multi-threaded functions run on the calling thread:
+void
+base64_encode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	)
+{
+	BASE64_UNUSED(nthreads);
+	base64_encode(src, srclen, out, outlen, flags);
+}
+
+int
+base64_decode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	, size_t	*error_offset
+	)
+{
+	const int ret = base64_decode(src, srclen, out, outlen, flags);
+
+	BASE64_UNUSED(nthreads);
+	if (error_offset != NULL) {
+		*error_offset = srclen;
+		if (ret == 0) {
+			base64_validate(src, srclen, flags, NULL, error_offset);
+		}
+	}
+	return ret;
+}
+
+void
+base64_mt_shutdown (void)
+{
+}
+
+void
+base64_mt_set_pinning (int pin)
+{
+	BASE64_UNUSED(pin);
+}
+#endif
+
 void
 base64_encode
 	( const char	*src
@@ -107,31 +932,99 @@ base64_encode
 	, size_t	*outlen
 	, int		 flags
 	)
+{
+	base64_encode_alphabet(src, srclen, out, outlen, flags, NULL);
+}
+
+void
+base64_encode_alphabet
+	( const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	, const struct base64_alphabet	*alphabet
+	)
 {
 	size_t s;
 	size_t t;
 	struct base64_state state;
+	const struct base64_codec *codec = base64_codec_get(flags);
 
 	#ifdef _OPENMP
-	if (srclen >= OMP_THRESHOLD) {
-		base64_encode_openmp(src, srclen, out, outlen, flags);
+	if (srclen >= base64_parallel_cutoff(BASE64_PARALLEL_OPENMP, codec, 0)) {
+		base64_encode_openmp(src, srclen, out, outlen, flags, alphabet);
+		return;
+	}
+	#endif
+
+	#if BASE64_WORDSIZE >= 32
+	// Inputs that the codec is slower on take the short path:
+	if (srclen <= codec->small_enc) {
+		base64_encode_small(base64_tables_for(flags, alphabet), (const uint8_t *) src, srclen, (uint8_t *) out, outlen, flags);
 		return;
 	}
 	#endif
 
 	// Init the stream reader:
-	base64_stream_encode_init(&state, flags);
+	base64_state_init(&state, flags, codec);
+	base64_stream_set_alphabet(&state, alphabet);
 
-	// Feed the whole string to the stream reader:
-	base64_stream_encode(&state, src, srclen, out, &s);
+	// Feed the whole string to the codec. The output is never wrapped, so
+	// skip the stream functions and their line breaking:
+	state.codec->enc(&state, src, srclen, out, &s);
 
-	// Finalize the stream by writing trailer if any:
-	base64_stream_encode_final(&state, out + s, &t);
+	// Write the trailer, if any:
+	t = base64_encode_trailer(&state, (uint8_t *) out + s);
 
 	// Final output length is stream length plus tail:
 	*outlen = s + t;
 }
 
+// Encode back to front. The partial group at the end and the trailer go
+// first, through a buffer. The whole groups follow in blocks of the last
+// quarter of the input that is left, rounded up to whole groups, so that the
+// output of a block starts at or past the end of its input. The codec can
+// then encode each block front to back as usual:
+void
+base64_encode_inplace
+	( char		*buf
+	, size_t	 len
+	, size_t	*outlen
+	, int		 flags
+	)
+{
+	struct base64_state state;
+	const struct base64_codec *codec = base64_codec_get(flags);
+	size_t n = len / 3 * 3;
+	size_t s, t;
+	char tmp[4];
+
+	base64_state_init(&state, flags, codec);
+	codec->enc(&state, buf + n, len - n, tmp, &s);
+	t = base64_encode_trailer(&state, (uint8_t *) tmp + s);
+	memcpy(buf + n / 3 * 4, tmp, s + t);
+
+	*outlen = n / 3 * 4 + s + t;
+
+	while (n > 0) {
+		size_t a = (n + 3) / 4 * 3;
+
+		base64_state_init(&state, flags, codec);
+
+		// The output of the last three groups overlaps their input:
+		if (a >= n) {
+			a = n - 3;
+			codec->enc(&state, buf + a, 3, tmp, &s);
+			memcpy(buf + a / 3 * 4, tmp, 4);
+		}
+		else {
+			codec->enc(&state, buf + a, n - a, buf + a / 3 * 4, &s);
+		}
+		n = a;
+	}
+}
+
 int
 base64_decode
 	( const char	*src
@@ -140,25 +1033,354 @@ base64_decode
 	, size_t	*outlen
 	, int		 flags
 	)
+{
+	return base64_decode_alphabet(src, srclen, out, outlen, flags, NULL);
+}
+
+int
+base64_decode_alphabet
+	( const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	, const struct base64_alphabet	*alphabet
+	)
 {
 	int ret;
 	struct base64_state state;
+	const struct base64_codec *codec = base64_codec_get(flags);
 
 	#ifdef _OPENMP
-	if (srclen >= OMP_THRESHOLD) {
-		return base64_decode_openmp(src, srclen, out, outlen, flags);
+	// The parallel decoder splits the input on quad boundaries, which it
+	// cannot find when bytes are skipped:
+	if (!(flags & (BASE64_IGNORE_SPACE | BASE64_FORGIVING)) && srclen >= base64_parallel_cutoff(BASE64_PARALLEL_OPENMP, codec, 1)) {
+		return base64_decode_openmp(src, srclen, out, outlen, flags, alphabet);
+	}
+	#endif
+
+	#if BASE64_WORDSIZE >= 32
+	// Bytes cannot be skipped on the short path. If it finds the input
+	// malformed, decode it again to report the error:
+	if (srclen <= codec->small_dec && !(flags & (BASE64_IGNORE_SPACE | BASE64_FORGIVING))) {
+		if (base64_decode_small(base64_tables_for(flags, alphabet), (const uint8_t *) src, srclen, (uint8_t *) out, outlen, flags)) {
+			return 1;
+		}
 	}
 	#endif
 
 	// Init the stream reader:
-	base64_stream_decode_init(&state, flags);
+	base64_state_init(&state, flags, codec);
+	base64_stream_set_alphabet(&state, alphabet);
 
 	// Feed the whole string to the stream reader:
 	ret = base64_stream_decode(&state, src, srclen, out, outlen);
 
 	// If when decoding a whole block, we're still waiting for input then fail:
-	if (ret && (state.bytes == 0)) {
+	if (ret && base64_stream_decode_complete(&state)) {
 		return ret;
 	}
 	return 0;
 }
+
+// Each codec writes its output behind the input that it has read, including
+// the slack of the SIMD stores, so that it can decode over its own input. The
+// parallel paths cannot, since each thread writes over the input of the
+// threads before it, and neither can the short path, which is not written to
+// allow it:
+int
+base64_decode_inplace
+	( char		*buf
+	, size_t	 len
+	, size_t	*outlen
+	, int		 flags
+	)
+{
+	int ret;
+	struct base64_state state;
+
+	base64_state_init(&state, flags, base64_codec_get(flags));
+	ret = base64_stream_decode(&state, buf, len, buf, outlen);
+
+	if (ret && base64_stream_decode_complete(&state)) {
+		return ret;
+	}
+	return 0;
+}
+
+size_t
+base64_encoded_length (size_t srclen, int flags)
+{
+	// Without padding, a final group of one or two bytes takes two or three
+	// characters:
+	if (flags & (BASE64_NOPAD | BASE64_FORBID_PAD)) {
+		return srclen / 3 * 4 + (srclen % 3 * 4 + 2) / 3;
+	}
+	return (srclen + 2) / 3 * 4;
+}
+
+size_t
+base64_decoded_length_max (size_t srclen)
+{
+	return srclen / 4 * 3 + srclen % 4 * 3 / 4;
+}
+
+int
+base64_encode_bounded
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	 outcap
+	, size_t	*outlen
+	, int		 flags
+	)
+{
+	// The encoders write exactly the output and nothing more:
+	if (base64_encoded_length(srclen, flags) > outcap) {
+		*outlen = 0;
+		return 0;
+	}
+	base64_encode(src, srclen, out, outlen, flags);
+	return 1;
+}
+
+int
+base64_decode_bounded
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	 outcap
+	, size_t	*outlen
+	, int		 flags
+	)
+{
+	struct base64_state state;
+	size_t head, total, n;
+	int ret;
+
+	// The SIMD decoders store a few bytes past the output of each round,
+	// but a call never writes beyond base64_decoded_length_max() of its
+	// input length. If that fits, decode as usual:
+	if (base64_decoded_length_max(srclen) <= outcap) {
+		return base64_decode(src, srclen, out, outlen, flags);
+	}
+
+	// Otherwise decode as much of the input as is safe straight into the
+	// output, and the rest through a buffer on the stack, from which only
+	// the bytes that fit are copied. With up to three characters pending in
+	// the state, 1024 bytes of input decode to at most 770 bytes:
+	head = outcap / 3 * 4;
+
+	base64_stream_decode_init(&state, flags);
+	ret = base64_stream_decode(&state, src, head, out, &total);
+
+	while (ret == 1 && head < srclen) {
+		char buf[1024];
+		size_t len = srclen - head;
+
+		if (len > sizeof (buf)) {
+			len = sizeof (buf);
+		}
+		ret = base64_stream_decode(&state, src + head, len, buf, &n);
+		if (n > outcap - total) {
+			ret = 0;
+			break;
+		}
+		memcpy(out + total, buf, n);
+		total += n;
+		head += len;
+	}
+
+	*outlen = total;
+
+	if (ret == 1 && !base64_stream_decode_complete(&state)) {
+		return 0;
+	}
+	return ret;
+}
+
+// Encode and decode exactly `len` bytes with the kernel `k` of the codec. For
+// codecs without kernels, `len` is a constant in each of the fixed-width
+// functions below, so that the loops of the short path unroll into
+// straight-line code:
+static inline void
+base64_encode_fixed (const char *src, char *out, int flags, size_t len, size_t k)
+{
+	const struct base64_fixed *fixed = base64_codec_get(flags)->fixed;
+	size_t outlen;
+
+	if (fixed != NULL) {
+		fixed->enc[k](src, out, flags);
+		return;
+	}
+#if BASE64_WORDSIZE >= 32
+	base64_encode_small(base64_tables_for(flags, NULL), (const uint8_t *) src, len, (uint8_t *) out, &outlen, flags);
+#else
+	base64_encode(src, len, out, &outlen, flags);
+#endif
+}
+
+// Check the whole input of a fixed-width decoder before any output is
+// written. The padding, if any, must fill the last quantum exactly, since
+// padding anywhere else would decode to another length:
+static inline int
+base64_decode_fixed_check (const struct base64_tables *tables, const uint8_t *src, size_t len, int flags)
+{
+	const size_t chars  = (len * 4 + 2) / 3;
+	const size_t srclen = base64_encoded_length(len, flags);
+	unsigned int bad = 0;
+
+	for (size_t i = 0; i < chars; i++) {
+		bad |= tables->dec_8bit[src[i]] & 0xC0U;
+	}
+	for (size_t i = chars; i < srclen; i++) {
+		bad |= tables->dec_8bit[src[i]] ^ 254U;
+	}
+
+	// The unused bits of the last character:
+	if (len % 3 != 0 && (flags & BASE64_STRICT)) {
+		bad |= tables->dec_8bit[src[chars - 1]] & ((len % 3 == 1) ? 0x0FU : 0x03U);
+	}
+	return bad == 0;
+}
+
+static inline int
+base64_decode_fixed (const char *src, char *out, int flags, size_t len, size_t k)
+{
+	const struct base64_fixed *fixed = base64_codec_get(flags)->fixed;
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	size_t outlen;
+
+	if (fixed != NULL) {
+		return fixed->dec[k](src, out, flags);
+	}
+	if (!base64_decode_fixed_check(tables, (const uint8_t *) src, len, flags)) {
+		return 0;
+	}
+
+	// The input is known to be good, so decode it straight into the output:
+#if BASE64_WORDSIZE >= 32
+	return base64_decode_small(tables, (const uint8_t *) src, base64_encoded_length(len, flags), (uint8_t *) out, &outlen, flags);
+#else
+	return base64_decode(src, base64_encoded_length(len, flags), out, &outlen, flags);
+#endif
+}
+
+void base64_encode_16 (const char *src, char *out, int flags) { base64_encode_fixed(src, out, flags, 16, 0); }
+void base64_encode_20 (const char *src, char *out, int flags) { base64_encode_fixed(src, out, flags, 20, 1); }
+void base64_encode_32 (const char *src, char *out, int flags) { base64_encode_fixed(src, out, flags, 32, 2); }
+void base64_encode_48 (const char *src, char *out, int flags) { base64_encode_fixed(src, out, flags, 48, 3); }
+void base64_encode_64 (const char *src, char *out, int flags) { base64_encode_fixed(src, out, flags, 64, 4); }
+
+int base64_decode_16 (const char *src, char *out, int flags) { return base64_decode_fixed(src, out, flags, 16, 0); }
+int base64_decode_20 (const char *src, char *out, int flags) { return base64_decode_fixed(src, out, flags, 20, 1); }
+int base64_decode_32 (const char *src, char *out, int flags) { return base64_decode_fixed(src, out, flags, 32, 2); }
+int base64_decode_48 (const char *src, char *out, int flags) { return base64_decode_fixed(src, out, flags, 48, 3); }
+int base64_decode_64 (const char *src, char *out, int flags) { return base64_decode_fixed(src, out, flags, 64, 4); }
+
+// The unused bits of the last character of an incomplete quantum, shifted as
+// in the carry of the decoder:
+static inline uint8_t
+base64_unused_bits (size_t chars, uint8_t last)
+{
+	return (uint8_t) (last << ((chars % 4 == 2) ? 4 : 6));
+}
+
+int
+base64_validate
+	( const char	*src
+	, size_t	 srclen
+	, int		 flags
+	, size_t	*decoded_len
+	, size_t	*error_offset
+	)
+{
+	struct base64_state state;
+	const uint8_t *s = (const uint8_t *) src;
+	size_t i = 0;
+	size_t chars = 0;
+	int pads = 0;
+	int need = 0;
+	int ret = 0;
+	uint8_t last = 0;
+
+	// Init a decoder state only to choose the codec and the tables:
+	base64_stream_decode_init(&state, flags);
+
+	const struct base64_tables *tables = base64_tables_choose(&state);
+	const uint8_t *ignore
+		= (flags & BASE64_IGNORE_SPACE) ? base64_ignore_space.table
+		: (flags & BASE64_FORGIVING)    ? base64_ignore_forgiving.table
+		: NULL;
+
+	// The codec finds the runs of alphabet characters with the validation
+	// step of its decoder. The bytes that end the runs follow the rules of
+	// the bytewise decoder, with ignored bytes removed from the input:
+	for (; i < srclen; i++) {
+		if (pads == 0) {
+			const size_t n = state.codec->span(&state, src + i, srclen - i);
+
+			if (n > 0) {
+				last = tables->dec_8bit[s[i + n - 1]];
+			}
+			i += n;
+			chars += n;
+			if (i == srclen) {
+				break;
+			}
+		}
+		if (ignore != NULL && ignore[s[i]] == BASE64_IGNORE_BYTE) {
+			continue;
+		}
+
+		const uint8_t q = tables->dec_8bit[s[i]];
+
+		// Count the characters of the alphabet, which may not follow padding:
+		if (q < 64 && pads == 0) {
+			last = q;
+			chars++;
+			continue;
+		}
+
+		// The padding character ends the input after the second or third
+		// character of a quantum, with two or one padding characters, if
+		// the policy allows it:
+		if (q == 254) {
+			if (pads == 0) {
+				need = 4 - (int) (chars % 4);
+				if (need <= 2 && !base64_pad_allowed(flags, base64_unused_bits(chars, last))) {
+					break;
+				}
+			}
+			if (need <= 2 && pads < need) {
+				pads++;
+				continue;
+			}
+		}
+		break;
+	}
+
+	// Check that the whole input was read, and that it ends at a valid end
+	// of a quantum:
+	if (i < srclen) {
+		ret = 0;
+	}
+	else if (pads > 0) {
+		ret = (pads == need);
+	}
+	else if (chars % 4 == 0) {
+		ret = 1;
+	}
+	else if (base64_pad_optional(flags, tables)) {
+		ret = (chars % 4 >= 2)
+		   && (!(flags & BASE64_STRICT) || base64_unused_bits(chars, last) == 0);
+	}
+
+	if (decoded_len != NULL) {
+		*decoded_len = chars / 4 * 3 + (chars % 4) * 3 / 4;
+	}
+	if (error_offset != NULL) {
+		*error_offset = ret ? srclen : i;
+	}
+	return ret;
+}
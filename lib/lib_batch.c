@@ -0,0 +1,281 @@
+// Batches of small, independent buffers are gathered into a buffer on the
+// stack, so that the codec runs over many of them in a single call, and the
+// setup of the state and of the SIMD loops is paid once per run of items
+// rather than once per item. The output is then scattered to the arena.
+//
+// On encoding, each item is zero-filled to a whole number of groups of three
+// bytes, so that its output starts on a quad boundary of the run. The
+// characters that encode the filler are dropped or replaced with padding. On
+// decoding, the padding of each item, or the characters missing from its last
+// quad, are replaced by the character that decodes to zero. The bytes that
+// these characters yield are dropped, after checking the unused bits of the
+// last real character against the policy.
+//
+// Items that are larger than BASE64_BATCH_ITEM, and items that cannot be
+// staged, are encoded or decoded on their own. So are the items that are small
+// enough for the short path of one-shot calls, which beats the codec on them
+// even when the setup is shared.
+
+#define BASE64_BATCH_ITEM	96
+#define BASE64_BATCH_STAGE	2048
+
+// Encode a single item, on the short path if it is at most `small` bytes:
+static inline void
+base64_batch_encode_item
+	( const struct base64_tables	*tables
+	, size_t			 small
+	, const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	)
+{
+#if BASE64_WORDSIZE >= 32
+	if (srclen <= small) {
+		base64_encode_small(tables, (const uint8_t *) src, srclen, (uint8_t *) out, outlen, flags);
+		return;
+	}
+#else
+	BASE64_UNUSED(tables);
+	BASE64_UNUSED(small);
+#endif
+	base64_encode(src, srclen, out, outlen, flags);
+}
+
+// Decode a single item, on the short path if it is at most `small` characters.
+// On error, the item is decoded again on the regular path to report it:
+static inline int
+base64_batch_decode_item
+	( const struct base64_tables	*tables
+	, size_t			 small
+	, const char			*src
+	, size_t			 srclen
+	, char				*out
+	, size_t			*outlen
+	, int				 flags
+	)
+{
+#if BASE64_WORDSIZE >= 32
+	if (srclen <= small && base64_decode_small(tables, (const uint8_t *) src, srclen, (uint8_t *) out, outlen, flags)) {
+		return 1;
+	}
+#else
+	BASE64_UNUSED(tables);
+	BASE64_UNUSED(small);
+#endif
+	return base64_decode(src, srclen, out, outlen, flags);
+}
+
+void
+base64_encode_batch
+	( const char *const	*src
+	, const size_t		*srclen
+	, size_t		 count
+	, char			*out
+	, size_t		*offsets
+	, int			 flags
+	)
+{
+	const struct base64_codec *codec = base64_codec_get(flags);
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const int pad = !(flags & (BASE64_NOPAD | BASE64_FORBID_PAD)) && tables->pad != 0;
+
+	const size_t small = codec->small_enc;
+
+	// The stage holds whole groups of three bytes, with room for the two
+	// filler bytes that are always written after an item:
+	char stage[BASE64_BATCH_STAGE / 4 * 3 + 2];
+	char enc[BASE64_BATCH_STAGE];
+
+	size_t total = 0;
+	size_t i = 0;
+
+	offsets[0] = 0;
+
+	while (i < count) {
+		struct base64_state state;
+		const char *e = enc;
+		const size_t first = i;
+		size_t slen = 0;
+		size_t elen;
+
+		if (srclen[i] <= small || srclen[i] > BASE64_BATCH_ITEM) {
+			base64_batch_encode_item(tables, small, src[i], srclen[i], out + total, &elen, flags);
+			total += elen;
+			offsets[++i] = total;
+			continue;
+		}
+
+		// Gather the run of items that fits on the stage:
+		for (; i < count; i++) {
+			const size_t len = srclen[i];
+
+			if (len <= small || len > BASE64_BATCH_ITEM || slen + len > sizeof (stage) - 2) {
+				break;
+			}
+			memcpy(stage + slen, src[i], len);
+			stage[slen + len + 0] = 0;
+			stage[slen + len + 1] = 0;
+			slen += (len + 2) / 3 * 3;
+		}
+
+		base64_state_init(&state, flags, codec);
+		codec->enc(&state, stage, slen, enc, &elen);
+
+		// Scatter the output of each item, and pad it:
+		for (size_t k = first; k < i; k++) {
+			const size_t len = srclen[k];
+			const size_t n = base64_encoded_length(len, flags);
+
+			memcpy(out + total, e, n);
+			if (pad && len % 3 != 0) {
+				out[total + n - 1] = (char) tables->pad;
+				if (len % 3 == 1) {
+					out[total + n - 2] = (char) tables->pad;
+				}
+			}
+			e += (len + 2) / 3 * 4;
+			total += n;
+			offsets[k + 1] = total;
+		}
+	}
+}
+
+// Return the number of characters at the end of an item that are replaced or
+// added on the stage, or -1 if the item cannot be staged:
+static inline int
+base64_batch_fill (const char *src, size_t srclen, int flags, const struct base64_tables *tables)
+{
+	if (srclen > BASE64_BATCH_ITEM || srclen % 4 == 1) {
+		return -1;
+	}
+
+	// A missing part of the last quad is filled in if the policy lets the
+	// input end without padding:
+	if (srclen % 4 != 0) {
+		return base64_pad_optional(flags, tables) ? (int) (4 - srclen % 4) : -1;
+	}
+
+	// Padding is replaced, unless the policy forbids it. Any other misplaced
+	// pad is left to the codec to reject:
+	if (srclen == 0 || (uint8_t) src[srclen - 1] != tables->pad) {
+		return 0;
+	}
+	if (flags & BASE64_FORBID_PAD) {
+		return -1;
+	}
+	return ((uint8_t) src[srclen - 2] == tables->pad) ? 2 : 1;
+}
+
+size_t
+base64_decode_batch
+	( const char *const	*src
+	, const size_t		*srclen
+	, size_t		 count
+	, char			*out
+	, size_t		*offsets
+	, int			*results
+	, int			 flags
+	)
+{
+	const struct base64_codec *codec = base64_codec_get(flags);
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	const char zero = (char) tables->enc_6bit[0];
+
+	// Bytes cannot be skipped on the stage, nor on the short path:
+	const int staged = !(flags & (BASE64_IGNORE_SPACE | BASE64_FORGIVING));
+	const size_t small = staged ? codec->small_dec : 0;
+
+	char stage[BASE64_BATCH_STAGE];
+	char dec[BASE64_BATCH_STAGE / 4 * 3];
+	signed char fills[BASE64_BATCH_STAGE / 4];
+
+	size_t total = 0;
+	size_t valid = 0;
+	size_t i = 0;
+
+	offsets[0] = 0;
+
+	while (i < count) {
+		struct base64_state state;
+		const char *d = dec;
+		const size_t first = i;
+		size_t slen = 0;
+		size_t dlen;
+		int ret;
+
+		if (!staged || srclen[i] <= small || base64_batch_fill(src[i], srclen[i], flags, tables) < 0) {
+			ret = base64_batch_decode_item(tables, small, src[i], srclen[i], out + total, &dlen, flags);
+			if (ret == 1) {
+				total += dlen;
+				valid++;
+			}
+			if (results != NULL) {
+				results[i] = ret;
+			}
+			offsets[++i] = total;
+			continue;
+		}
+
+		// Gather the run of items that can be staged and that fits:
+		for (; i < count && i - first < sizeof (fills); i++) {
+			const size_t len = srclen[i];
+			const size_t quads = (len + 3) / 4 * 4;
+			const int fill = base64_batch_fill(src[i], len, flags, tables);
+
+			if (len <= small || fill < 0 || slen + quads > sizeof (stage)) {
+				break;
+			}
+			memcpy(stage + slen, src[i], len);
+			memset(stage + slen + quads - (size_t) fill, zero, (size_t) fill);
+			fills[i - first] = (signed char) fill;
+			slen += quads;
+		}
+
+		base64_state_init(&state, flags, codec);
+		ret = codec->dec(&state, stage, slen, dec, &dlen);
+
+		if (dlen != slen / 4 * 3) {
+			ret = 0;
+		}
+
+		// Scatter the output of each item. If the run was not valid as a
+		// whole, decode its items again one by one to tell which failed:
+		for (size_t k = first; k < i; k++) {
+			const size_t len = srclen[k];
+			int ok;
+
+			if (ret == 1) {
+				const int drop = fills[k - first];
+				const size_t n = (len + 3) / 4 * 3 - (size_t) drop;
+
+				// The dropped bytes hold the unused bits of the last
+				// real character:
+				ok = !(flags & BASE64_STRICT)
+				  || ((drop < 1 || d[n] == 0) && (drop < 2 || d[n + 1] == 0));
+
+				if (ok) {
+					memcpy(out + total, d, n);
+					total += n;
+				}
+				d += n + (size_t) drop;
+			}
+			else {
+				ok = base64_batch_decode_item(tables, small, src[k], len, out + total, &dlen, flags);
+
+				if (ok == 1) {
+					total += dlen;
+				}
+			}
+			if (ok == 1) {
+				valid++;
+			}
+			if (results != NULL) {
+				results[k] = ok;
+			}
+			offsets[k + 1] = total;
+		}
+	}
+	return valid;
+}
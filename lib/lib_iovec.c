@@ -0,0 +1,252 @@
+// Scatter/gather encoding and decoding. The input segments are fed to the
+// codec one after the other through a single stream state, which carries the
+// bytes of an incomplete group across the segment boundaries, so that the
+// SIMD loops run over each segment in place. The output is written straight
+// into the output segments, as much as is known to fit in the current one.
+// Only the few bytes that straddle the end of an output segment go through a
+// buffer on the stack.
+
+#ifdef _WIN32
+// Windows has no <sys/uio.h>. Use the layout of the POSIX structure:
+struct iovec
+{
+	void	*iov_base;
+	size_t	 iov_len;
+};
+#else
+#include <sys/uio.h>
+#endif
+
+// The write position in a vector of output segments:
+struct base64_iov_pos
+{
+	const struct iovec	*iov;
+	size_t			 cnt;
+	size_t			 off;
+	size_t			 total;
+};
+
+// Return the room left in the current output segment, after moving on past
+// the segments that are full:
+static inline size_t
+base64_iov_room (struct base64_iov_pos *pos)
+{
+	while (pos->cnt > 0 && pos->off == pos->iov->iov_len) {
+		pos->iov++;
+		pos->cnt--;
+		pos->off = 0;
+	}
+	return (pos->cnt > 0) ? pos->iov->iov_len - pos->off : 0;
+}
+
+static inline char *
+base64_iov_ptr (const struct base64_iov_pos *pos)
+{
+	return (char *) pos->iov->iov_base + pos->off;
+}
+
+static inline void
+base64_iov_advance (struct base64_iov_pos *pos, size_t len)
+{
+	pos->off   += len;
+	pos->total += len;
+}
+
+// Copy `len` bytes to the output, across as many segments as it takes.
+// Returns 0 if they do not fit:
+static inline int
+base64_iov_write (struct base64_iov_pos *pos, const char *buf, size_t len)
+{
+	while (len > 0) {
+		size_t n = base64_iov_room(pos);
+
+		if (n == 0) {
+			return 0;
+		}
+		if (n > len) {
+			n = len;
+		}
+		memcpy(base64_iov_ptr(pos), buf, n);
+		base64_iov_advance(pos, n);
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+// Decode a quad at `src` to three bytes at `out` with the 8-bit table. Returns
+// 0 if any of its characters is not in the alphabet:
+static inline int
+base64_iov_quad (const uint8_t *dec, const char *src, char *out)
+{
+	const uint8_t c0 = dec[(uint8_t) src[0]];
+	const uint8_t c1 = dec[(uint8_t) src[1]];
+	const uint8_t c2 = dec[(uint8_t) src[2]];
+	const uint8_t c3 = dec[(uint8_t) src[3]];
+
+	if ((c0 | c1 | c2 | c3) >= 64) {
+		return 0;
+	}
+	out[0] = (char) (c0 << 2 | c1 >> 4);
+	out[1] = (char) (c1 << 4 | c2 >> 2);
+	out[2] = (char) (c2 << 6 | c3);
+	return 1;
+}
+
+int
+base64_encodev
+	( const struct iovec	*src
+	, size_t		 srccnt
+	, const struct iovec	*out
+	, size_t		 outcnt
+	, size_t		*outlen
+	, int			 flags
+	)
+{
+	struct base64_iov_pos pos = { out, outcnt, 0, 0 };
+	const struct base64_tables *tables = base64_tables_for(flags, NULL);
+	struct base64_state state;
+	char buf[4];
+	size_t n;
+
+	base64_stream_encode_init(&state, flags);
+
+	for (size_t i = 0; i < srccnt; i++) {
+		const char *s = (const char *) src[i].iov_base;
+		size_t slen = src[i].iov_len;
+
+		while (slen > 0) {
+			size_t len = base64_iov_room(&pos) / 4 * 3;
+
+			// Encode as much of the input as fits into the current
+			// output segment in place. Together with the bytes in
+			// the state, `len` bytes encode to at most the room:
+			if (len > (size_t) state.bytes) {
+				len -= (size_t) state.bytes;
+				if (len > slen) {
+					len = slen;
+				}
+				state.codec->enc(&state, s, len, base64_iov_ptr(&pos), &n);
+				base64_iov_advance(&pos, n);
+			}
+
+			// Otherwise the next quad straddles the end of the
+			// segment. A whole group is encoded with the tables,
+			// which is cheaper than a call to the codec:
+			else if (state.bytes == 0 && slen >= 3) {
+				const uint8_t *g = (const uint8_t *) s;
+
+				len = 3;
+				buf[0] = (char) tables->enc_6bit[g[0] >> 2];
+				buf[1] = (char) tables->enc_6bit[(g[0] << 4 | g[1] >> 4) & 0x3F];
+				buf[2] = (char) tables->enc_6bit[(g[1] << 2 | g[2] >> 6) & 0x3F];
+				buf[3] = (char) tables->enc_6bit[g[2] & 0x3F];
+				if (!base64_iov_write(&pos, buf, 4)) {
+					*outlen = pos.total;
+					return 0;
+				}
+			}
+
+			// Else complete the group in the state, and spread it
+			// out:
+			else {
+				len = 3 - (size_t) state.bytes;
+				if (len > slen) {
+					len = slen;
+				}
+				state.codec->enc(&state, s, len, buf, &n);
+				if (!base64_iov_write(&pos, buf, n)) {
+					*outlen = pos.total;
+					return 0;
+				}
+			}
+			s    += len;
+			slen -= len;
+		}
+	}
+
+	// Write the trailer, if any:
+	n = base64_encode_trailer(&state, (uint8_t *) buf);
+
+	if (!base64_iov_write(&pos, buf, n)) {
+		*outlen = pos.total;
+		return 0;
+	}
+	*outlen = pos.total;
+	return 1;
+}
+
+int
+base64_decodev
+	( const struct iovec	*src
+	, size_t		 srccnt
+	, const struct iovec	*out
+	, size_t		 outcnt
+	, size_t		*outlen
+	, int			 flags
+	)
+{
+	struct base64_iov_pos pos = { out, outcnt, 0, 0 };
+	const uint8_t *d = base64_tables_for(flags, NULL)->dec_8bit;
+	const int skip = flags & (BASE64_IGNORE_SPACE | BASE64_FORGIVING);
+	struct base64_state state;
+	char buf[8];
+	int ret = 1;
+
+	base64_stream_decode_init(&state, flags);
+
+	for (size_t i = 0; i < srccnt && ret == 1; i++) {
+		const char *s = (const char *) src[i].iov_base;
+		size_t slen = src[i].iov_len;
+
+		while (slen > 0 && ret == 1) {
+			const size_t pending = (size_t) state.bytes + (size_t) state.ignore_bytes;
+			size_t len = base64_iov_room(&pos) / 3 * 4;
+			size_t n;
+
+			// Decode as much of the input as fits into the current
+			// output segment in place. A call never writes beyond
+			// the decoding of its input and of the characters that
+			// are pending in the state:
+			if (len > pending) {
+				len -= pending;
+				if (len > slen) {
+					len = slen;
+				}
+				ret = base64_stream_decode(&state, s, len, base64_iov_ptr(&pos), &n);
+				base64_iov_advance(&pos, n);
+			}
+
+			// Otherwise the next group straddles the end of the
+			// segment. A whole quad of valid characters is decoded
+			// with the tables, which is cheaper than a call to the
+			// codec, if the state is between quads and no bytes are
+			// skipped:
+			else if (pending == 0 && state.eof == 0 && !skip && slen >= 4 && base64_iov_quad(d, s, buf)) {
+				len = 4;
+				if (!base64_iov_write(&pos, buf, 3)) {
+					ret = 0;
+				}
+			}
+
+			// Else decode the next few characters through a buffer,
+			// with up to six pending characters:
+			else {
+				len = (slen < 4) ? slen : 4;
+				ret = base64_stream_decode(&state, s, len, buf, &n);
+				if (!base64_iov_write(&pos, buf, n)) {
+					ret = 0;
+				}
+			}
+			s    += len;
+			slen -= len;
+		}
+	}
+
+	*outlen = pos.total;
+
+	if (ret == 1 && !base64_stream_decode_complete(&state)) {
+		return 0;
+	}
+	return ret;
+}
@@ -18,6 +18,7 @@ base64_encode_openmp
 	, char		*out
 	, size_t	*outlen
 	, int		 flags
+	, const struct base64_alphabet *alphabet
 	)
 {
 	size_t s;
@@ -42,8 +43,11 @@ base64_encode_openmp
 			len *= 3;
 			last_len = srclen - num_threads * len;
 
-			// Init the stream reader:
-			base64_stream_encode_init(&state, flags);
+			// Init the stream reader. The parts may be too small
+			// for the encoder to tell that the whole output is too
+			// large for the cache, so it is told:
+			base64_stream_encode_init(&state, (srclen >= BASE64_NONTEMPORAL_SIZE) ? flags | BASE64_NONTEMPORAL : flags);
+			base64_stream_set_alphabet(&state, alphabet);
 			initial_state = state;
 		}
 
@@ -80,9 +84,10 @@ base64_decode_openmp
 	, char		*out
 	, size_t	*outlen
 	, int		 flags
+	, const struct base64_alphabet *alphabet
 	)
 {
-	int num_threads, result = 0, i;
+	int num_threads, result = 0, i, cancel = 0;
 	size_t sum = 0, len, last_len, s;
 	struct base64_state state, initial_state;
 
@@ -97,13 +102,14 @@ base64_decode_openmp
 
 			// Split the input string into num_threads parts, each
 			// part a multiple of 4 bytes. The remaining bytes will
-			// be done later:
-			len = srclen / (num_threads * 4);
+			// be done later, and hold at least the last quad:
+			len = (srclen > 0) ? (srclen - 1) / (num_threads * 4) : 0;
 			len *= 4;
 			last_len = srclen - num_threads * len;
 
 			// Init the stream reader:
 			base64_stream_decode_init(&state, flags);
+			base64_stream_set_alphabet(&state, alphabet);
 
 			initial_state = state;
 		}
@@ -113,11 +119,39 @@ base64_decode_openmp
 		#pragma omp for firstprivate(state) private(s) reduction(+:sum, result) schedule(static,1)
 		for (i = 0; i < num_threads; i++)
 		{
-			int this_result;
-
-			// Feed each part of the string to the stream reader:
-			this_result = base64_stream_decode(&state, src + i * len, len, out + i * len * 3 / 4, &s);
-			sum += s;
+			int this_result = 1;
+			size_t done = 0;
+
+			// Feed each part of the string to the stream reader, a
+			// block at a time. Each block decodes to three bytes per
+			// quad, since padding may only come in the remaining
+			// bytes. Stop when any thread found an error:
+			while (done < len) {
+				const size_t n = (len - done < OMP_BLOCK) ? len - done : OMP_BLOCK;
+				int stop;
+
+				#pragma omp atomic read
+				stop = cancel;
+
+				if (stop) {
+					this_result = 0;
+					break;
+				}
+				state = initial_state;
+				this_result = base64_stream_decode(&state, src + i * len + done, n, out + (i * len + done) / 4 * 3, &s);
+				if (this_result == 1 && s != n / 4 * 3) {
+					this_result = 0;
+				}
+				if (this_result == 0) {
+					#pragma omp atomic write
+					cancel = 1;
+				}
+				if (this_result != 1) {
+					break;
+				}
+				sum += s;
+				done += n;
+			}
 			result += this_result;
 		}
 	}
@@ -142,7 +176,7 @@ base64_decode_openmp
 	*outlen = sum;
 
 	// If when decoding a whole block, we're still waiting for input then fail:
-	if (result && (state.bytes == 0)) {
+	if (result && base64_stream_decode_complete(&state)) {
 		return result;
 	}
 	return 0;
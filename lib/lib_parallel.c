@@ -0,0 +1,219 @@
+// The input length from which a call splits its work across threads. Below
+// it, waking up the threads and waiting for them costs more than the threads
+// save. This depends on how fast the codec is on one thread, and on the
+// round trip of the parallel backend, so both are measured once, on first
+// use: the speed of each codec in each direction, and the time it takes to
+// run an empty job on all threads. Splitting over two or more threads saves at
+// least half of the time of a call, which must make up for the round trip
+// with a margin of two. The cutoff is thus the input that takes four round
+// trips on one thread.
+//
+// The cutoff can be set with base64_set_parallel_threshold(), or with the
+// BASE64_PARALLEL_THRESHOLD environment variable.
+
+#include <stdlib.h>
+#include <time.h>
+
+// The parallel backends:
+#define BASE64_PARALLEL_OPENMP	0
+#define BASE64_PARALLEL_POOL	1
+
+#if defined(__GNUC__) || defined(__clang__)
+# define BASE64_LOAD_SIZE(p)		__atomic_load_n(&(p), __ATOMIC_RELAXED)
+# define BASE64_STORE_SIZE(p, v)	__atomic_store_n(&(p), (v), __ATOMIC_RELAXED)
+#else
+# define BASE64_LOAD_SIZE(p)		(*(volatile size_t *) &(p))
+# define BASE64_STORE_SIZE(p, v)	(*(volatile size_t *) &(p) = (v))
+#endif
+
+// The codecs whose speed is measured:
+static const struct base64_codec *const base64_parallel_codecs[] = {
+	&base64_codec_plain,
+	&base64_codec_ssse3,
+	&base64_codec_sse41,
+	&base64_codec_sse42,
+	&base64_codec_avx,
+	&base64_codec_avx2,
+	&base64_codec_avx512,
+	&base64_codec_avx512_vbmi2,
+	&base64_codec_neon32,
+	&base64_codec_neon64,
+};
+
+#define BASE64_PARALLEL_CODECS	(sizeof (base64_parallel_codecs) / sizeof (base64_parallel_codecs[0]))
+
+// The measurements, which are zero until taken. The speed is in bytes of
+// input per microsecond, for encoding and for decoding. The round trip is in
+// nanoseconds, or SIZE_MAX if the backend has a single thread:
+static size_t base64_parallel_speed[BASE64_PARALLEL_CODECS][2];
+static size_t base64_parallel_latency[2];
+
+// The cutoff that was set with the API, or else with the environment, if any.
+// The environment is read once:
+static size_t base64_parallel_set;
+static size_t base64_parallel_env;
+static size_t base64_parallel_env_read;
+
+// A monotonic clock in nanoseconds:
+static uint64_t
+base64_parallel_now (void)
+{
+#if BASE64_HAVE_PTHREADS
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+#else
+	return (uint64_t) (omp_get_wtime() * 1e9);
+#endif
+}
+
+// Measure the speed of a codec on a few kilobytes that stay in the L1 cache.
+// The best of three runs is kept, to leave out interrupts:
+static size_t
+base64_parallel_measure_speed (const struct base64_codec *codec, int dec)
+{
+	char plain[3072];
+	char text[4096];
+	struct base64_state state;
+	uint64_t best = UINT64_MAX;
+	size_t n;
+	int i, j;
+
+	memset(plain, 0, sizeof (plain));
+	base64_state_init(&state, 0, codec);
+	codec->enc(&state, plain, sizeof (plain), text, &n);
+
+	for (i = 0; i < 3; i++) {
+		const uint64_t start = base64_parallel_now();
+		uint64_t ns;
+
+		for (j = 0; j < 16; j++) {
+			base64_state_init(&state, 0, codec);
+			if (dec) {
+				codec->dec(&state, text, sizeof (text), plain, &n);
+			}
+			else {
+				codec->enc(&state, plain, sizeof (plain), text, &n);
+			}
+		}
+		ns = base64_parallel_now() - start;
+		if (ns < best) {
+			best = ns;
+		}
+	}
+	if (best == 0) {
+		best = 1;
+	}
+	return (size_t) (16000u * (dec ? sizeof (text) : sizeof (plain)) / best) + 1;
+}
+
+#if BASE64_HAVE_PTHREADS
+
+static void
+base64_job_none (struct base64_job *job, size_t chunk)
+{
+	BASE64_UNUSED(job);
+	BASE64_UNUSED(chunk);
+}
+
+#endif
+
+// Measure the round trip of an empty job on all threads of a backend. The
+// first one, which may start the threads, is left out:
+static size_t
+base64_parallel_measure_latency (int backend)
+{
+	uint64_t best = UINT64_MAX;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		const uint64_t start = base64_parallel_now();
+		uint64_t ns;
+
+		if (backend == BASE64_PARALLEL_POOL) {
+#if BASE64_HAVE_PTHREADS
+			struct base64_job job;
+			const int nthreads = base64_pool_threads_default();
+
+			if (nthreads == 1) {
+				return SIZE_MAX;
+			}
+			memset(&job, 0, sizeof (job));
+			job.run = base64_job_none;
+			job.nchunks = (size_t) nthreads;
+			base64_pool_run(&job, nthreads);
+#endif
+		}
+		else {
+#ifdef _OPENMP
+			if (omp_get_max_threads() == 1) {
+				return SIZE_MAX;
+			}
+			#pragma omp parallel
+			{
+			}
+#endif
+		}
+		ns = base64_parallel_now() - start;
+		if (i > 0 && ns < best) {
+			best = ns;
+		}
+	}
+	return (best < SIZE_MAX) ? (size_t) best + 1 : SIZE_MAX;
+}
+
+// The cutoff of a backend for a codec, in bytes of input:
+static size_t
+base64_parallel_cutoff (int backend, const struct base64_codec *codec, int dec)
+{
+	size_t cutoff = BASE64_LOAD_SIZE(base64_parallel_set);
+	size_t latency, speed, i;
+
+	if (cutoff != 0) {
+		return cutoff;
+	}
+	if (BASE64_LOAD_SIZE(base64_parallel_env_read) == 0) {
+		const char *env = getenv("BASE64_PARALLEL_THRESHOLD");
+
+		BASE64_STORE_SIZE(base64_parallel_env, (env != NULL) ? (size_t) strtoull(env, NULL, 10) : 0);
+		BASE64_STORE_SIZE(base64_parallel_env_read, 1);
+	}
+	if ((cutoff = BASE64_LOAD_SIZE(base64_parallel_env)) != 0) {
+		return cutoff;
+	}
+
+	// Measure what has not been measured yet. Concurrent first calls may
+	// both measure, which is harmless:
+	if ((latency = BASE64_LOAD_SIZE(base64_parallel_latency[backend])) == 0) {
+		latency = base64_parallel_measure_latency(backend);
+		BASE64_STORE_SIZE(base64_parallel_latency[backend], latency);
+	}
+	if (latency == SIZE_MAX) {
+		return SIZE_MAX;
+	}
+	for (i = 0; i < BASE64_PARALLEL_CODECS; i++) {
+		if (base64_parallel_codecs[i] == codec) {
+			break;
+		}
+	}
+	if (i == BASE64_PARALLEL_CODECS) {
+		return SIZE_MAX;
+	}
+	if ((speed = BASE64_LOAD_SIZE(base64_parallel_speed[i][dec])) == 0) {
+		speed = base64_parallel_measure_speed(codec, dec);
+		BASE64_STORE_SIZE(base64_parallel_speed[i][dec], speed);
+	}
+
+	// Four round trips at that speed:
+	if (latency > SIZE_MAX / 4 / speed) {
+		return SIZE_MAX;
+	}
+	return latency * 4 * speed / 1000;
+}
+
+void
+base64_set_parallel_threshold (size_t srclen)
+{
+	BASE64_STORE_SIZE(base64_parallel_set, srclen);
+}
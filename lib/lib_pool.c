@@ -0,0 +1,458 @@
+// A persistent pool of worker threads. The workers are started by the first
+// job that needs them, and sleep on a condition variable between jobs, so that
+// a job pays for waking them up rather than for creating a team of threads.
+// The pool grows to the largest number of threads that any job asked for.
+//
+// A job is a number of chunks of equal cost. The calling thread and the
+// workers take the chunks one at a time until none are left, so that a thread
+// that is descheduled or runs on a slower core leaves its share to the others.
+//
+// On a NUMA system, the chunks are sorted into one lane per node, by the node
+// that holds the first page of their input. A thread takes the chunks of its
+// own node first, then those whose input is not on any known node yet, and
+// only then steals from the lanes of the other nodes. A chunk's output is
+// written by the thread that reads its input, so that the first touch puts
+// the output pages on the same node. The workers can be pinned to the CPUs of
+// a node, round-robin, so that each node gets its share of them.
+
+#include <pthread.h>
+#include <unistd.h>
+#include <stdlib.h>
+#ifdef __linux__
+#include <sched.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#endif
+
+// The most workers that the pool starts, besides the calling thread:
+#define BASE64_POOL_MAX		63
+
+// The most NUMA nodes that are told apart:
+#define BASE64_POOL_NODES	16
+
+// A range of the chunks of a job, in the order of `order`:
+struct base64_lane
+{
+	size_t	next;
+	size_t	end;
+};
+
+struct base64_job
+{
+	void			(*run) (struct base64_job *job, size_t chunk);
+	const struct base64_codec *codec;
+	const struct base64_alphabet *alphabet;
+	const char		*src;
+	char			*out;
+	size_t			 srclen;
+	size_t			 chunk;
+	size_t			 nchunks;
+	size_t			 failed;
+	size_t			 failed_len;
+	int			 flags;
+
+	// The lane of each node, followed by the lane of the chunks on no
+	// known node. Without NUMA, all chunks are in the first lane, and
+	// `order` is NULL for the identity:
+	struct base64_lane	 lanes[BASE64_POOL_NODES + 1];
+	int			 nlanes;
+	size_t			*order;
+};
+
+// The pool. `lock` guards all of it; `busy` is held by the call that owns the
+// workers, so that concurrent calls take turns:
+static pthread_mutex_t	 base64_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t	 base64_pool_busy = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	 base64_pool_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t	 base64_pool_done = PTHREAD_COND_INITIALIZER;
+static pthread_t	 base64_pool_threads[BASE64_POOL_MAX];
+static int		 base64_pool_size;
+static int		 base64_pool_wanted;
+static int		 base64_pool_active;
+static int		 base64_pool_stop;
+static int		 base64_pool_pin;
+static unsigned long	 base64_pool_generation;
+static unsigned long	 base64_pool_started;
+static struct base64_job *base64_pool_job;
+
+// The NUMA topology, which is read when the pool first runs a job: the number
+// of nodes, the node of each CPU, and the CPUs of each node:
+static int		 base64_pool_nodes;
+#ifdef __linux__
+static signed char	 base64_pool_cpu_node[CPU_SETSIZE];
+static cpu_set_t	 base64_pool_node_cpus[BASE64_POOL_NODES];
+#endif
+
+static void
+base64_pool_topology (void)
+{
+	int node = 0;
+
+#ifdef __linux__
+	// Nodes are numbered from zero. A gap in the numbers ends the list:
+	for (; node < BASE64_POOL_NODES; node++) {
+		char path[64], line[1024];
+		char *p;
+		FILE *f;
+
+		snprintf(path, sizeof (path), "/sys/devices/system/node/node%d/cpulist", node);
+		if ((f = fopen(path, "r")) == NULL) {
+			break;
+		}
+		p = fgets(line, sizeof (line), f);
+		fclose(f);
+
+		// A list of CPUs and ranges of CPUs, such as "0-3,8,10-11":
+		CPU_ZERO(&base64_pool_node_cpus[node]);
+		while (p != NULL && *p >= '0' && *p <= '9') {
+			long lo = strtol(p, &p, 10);
+			long hi = (*p == '-') ? strtol(p + 1, &p, 10) : lo;
+
+			for (; lo <= hi && lo < CPU_SETSIZE; lo++) {
+				CPU_SET(lo, &base64_pool_node_cpus[node]);
+				base64_pool_cpu_node[lo] = (signed char) node;
+			}
+			if (*p == ',') {
+				p++;
+			}
+		}
+	}
+#endif
+	base64_pool_nodes = (node > 0) ? node : 1;
+}
+
+// The node of the CPU that the calling thread runs on:
+static int
+base64_pool_node (void)
+{
+#ifdef __linux__
+	const int cpu = sched_getcpu();
+
+	if (base64_pool_nodes > 1 && cpu >= 0 && cpu < CPU_SETSIZE) {
+		return base64_pool_cpu_node[cpu];
+	}
+#endif
+	return 0;
+}
+
+// The affinity of a worker. The workers are pinned to the CPUs of node `id`
+// modulo the number of nodes, and unpinned to the CPUs they started with:
+struct base64_pool_affinity
+{
+	int		 pinned;
+#ifdef __linux__
+	cpu_set_t	 initial;
+#endif
+};
+
+static void
+base64_pool_affinity_init (struct base64_pool_affinity *aff)
+{
+	aff->pinned = 0;
+#ifdef __linux__
+	if (pthread_getaffinity_np(pthread_self(), sizeof (aff->initial), &aff->initial) != 0) {
+		CPU_ZERO(&aff->initial);
+	}
+#endif
+}
+
+static void
+base64_pool_affinity_set (struct base64_pool_affinity *aff, int id, int pin)
+{
+#ifdef __linux__
+	const cpu_set_t *cpus = pin ? &base64_pool_node_cpus[id % base64_pool_nodes] : &aff->initial;
+
+	// Nodes without CPUs, and masks that could not be read, are left
+	// alone:
+	if (pin != aff->pinned && base64_pool_nodes > 1 && CPU_COUNT(cpus) > 0
+	 && pthread_setaffinity_np(pthread_self(), sizeof (*cpus), cpus) == 0) {
+		aff->pinned = pin;
+	}
+#else
+	BASE64_UNUSED(aff);
+	BASE64_UNUSED(id);
+	BASE64_UNUSED(pin);
+#endif
+}
+
+// Sort the chunks of a job into lanes by the node of the first page of their
+// input, which the kernel reports without moving the pages. The chunks of a
+// lane stay in order. Returns the array of the order, for the caller to free,
+// or NULL if the chunks are all left in the first lane:
+static size_t *
+base64_pool_lanes (struct base64_job *job)
+{
+	const int nodes = base64_pool_nodes;
+
+	memset(job->lanes, 0, sizeof (job->lanes));
+	job->lanes[0].end = job->nchunks;
+	job->nlanes = nodes + 1;
+	job->order = NULL;
+
+#ifdef __linux__
+	if (nodes > 1 && job->src != NULL) {
+		const uintptr_t mask = ~(uintptr_t) (sysconf(_SC_PAGESIZE) - 1);
+		void **pages = malloc(job->nchunks * sizeof (*pages));
+		int *status = malloc(job->nchunks * sizeof (*status));
+		size_t *order = malloc(job->nchunks * sizeof (*order));
+		size_t count[BASE64_POOL_NODES + 1] = { 0 };
+		size_t i, pos = 0;
+		int lane;
+
+		if (pages != NULL && status != NULL && order != NULL) {
+			for (i = 0; i < job->nchunks; i++) {
+				pages[i] = (void *) ((uintptr_t) (job->src + i * job->chunk) & mask);
+			}
+			if (syscall(SYS_move_pages, 0, (unsigned long) job->nchunks, pages, NULL, status, 0) == 0) {
+
+				// Pages that are not mapped yet, or are on a
+				// node beyond the topology, are on no node:
+				for (i = 0; i < job->nchunks; i++) {
+					if (status[i] < 0 || status[i] >= nodes) {
+						status[i] = nodes;
+					}
+					count[status[i]]++;
+				}
+				for (lane = 0; lane <= nodes; lane++) {
+					job->lanes[lane].next = job->lanes[lane].end = pos;
+					pos += count[lane];
+				}
+				for (i = 0; i < job->nchunks; i++) {
+					order[job->lanes[status[i]].end++] = i;
+				}
+				job->order = order;
+			}
+		}
+		free(pages);
+		free(status);
+		if (job->order == NULL) {
+			free(order);
+		}
+	}
+#endif
+	return job->order;
+}
+
+// Take the next chunk of a lane, or return SIZE_MAX if there is none:
+static inline size_t
+base64_lane_take (struct base64_lane *lane)
+{
+	size_t i;
+
+#if defined(__GNUC__) || defined(__clang__)
+	// Look before taking, so that the threads that steal do not keep
+	// the line of an empty lane bouncing between the nodes:
+	if (__atomic_load_n(&lane->next, __ATOMIC_RELAXED) >= lane->end) {
+		return SIZE_MAX;
+	}
+	i = __atomic_fetch_add(&lane->next, 1, __ATOMIC_RELAXED);
+#else
+	pthread_mutex_lock(&base64_pool_lock);
+	i = lane->next++;
+	pthread_mutex_unlock(&base64_pool_lock);
+#endif
+	return (i < lane->end) ? i : SIZE_MAX;
+}
+
+// Take the next chunk of a job for a thread on `node`: from the lane of the
+// node, else from the lane of the chunks on no known node, else from the
+// lanes of the other nodes in turn. Returns `nchunks` if none is left:
+static inline size_t
+base64_job_next (struct base64_job *job, int node)
+{
+	const int nodes = job->nlanes - 1;
+	int k;
+
+	for (k = 0; k <= nodes; k++) {
+		const int lane = (k == 0) ? node : (k == 1) ? nodes : (node + k - 1) % nodes;
+		const size_t i = base64_lane_take(&job->lanes[lane]);
+
+		if (i != SIZE_MAX) {
+			return (job->order != NULL) ? job->order[i] : i;
+		}
+	}
+	return job->nchunks;
+}
+
+// Record that a chunk failed, after writing `len` bytes of output. The lowest
+// failed chunk is kept. It is also the signal to cancel the chunks after it:
+static void
+base64_job_fail (struct base64_job *job, size_t chunk, size_t len)
+{
+	pthread_mutex_lock(&base64_pool_lock);
+	if (chunk < job->failed) {
+#if defined(__GNUC__) || defined(__clang__)
+		__atomic_store_n(&job->failed, chunk, __ATOMIC_RELAXED);
+#else
+		job->failed = chunk;
+#endif
+		job->failed_len = len;
+	}
+	pthread_mutex_unlock(&base64_pool_lock);
+}
+
+// The lowest chunk that failed so far, or `nchunks`:
+static inline size_t
+base64_job_failed (struct base64_job *job)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(&job->failed, __ATOMIC_RELAXED);
+#else
+	size_t chunk;
+
+	pthread_mutex_lock(&base64_pool_lock);
+	chunk = job->failed;
+	pthread_mutex_unlock(&base64_pool_lock);
+	return chunk;
+#endif
+}
+
+// Run chunks until none are left. Once a chunk failed, the chunks after it
+// are skipped. Those before it still run, since one of them may fail first:
+static void
+base64_job_work (struct base64_job *job, int node)
+{
+	size_t chunk;
+
+	while ((chunk = base64_job_next(job, node)) < job->nchunks) {
+		if (chunk < base64_job_failed(job)) {
+			job->run(job, chunk);
+		}
+	}
+}
+
+static void *
+base64_pool_worker (void *arg)
+{
+	const int id = (int) (intptr_t) arg;
+	struct base64_pool_affinity aff;
+	unsigned long seen;
+
+	base64_pool_affinity_init(&aff);
+
+	// A new worker may only get the lock after its first job was posted.
+	// The generation it was started in is the one before:
+	pthread_mutex_lock(&base64_pool_lock);
+	seen = base64_pool_started;
+
+	for (;;) {
+		struct base64_job *job;
+		int pin;
+
+		while (!base64_pool_stop && base64_pool_generation == seen) {
+			pthread_cond_wait(&base64_pool_wake, &base64_pool_lock);
+		}
+		if (base64_pool_stop) {
+			break;
+		}
+		seen = base64_pool_generation;
+
+		// Sit out the jobs that need fewer workers:
+		if (id >= base64_pool_wanted) {
+			continue;
+		}
+		job = base64_pool_job;
+		pin = base64_pool_pin;
+		pthread_mutex_unlock(&base64_pool_lock);
+
+		base64_pool_affinity_set(&aff, id, pin);
+		base64_job_work(job, aff.pinned ? id % base64_pool_nodes : base64_pool_node());
+
+		pthread_mutex_lock(&base64_pool_lock);
+		if (--base64_pool_active == 0) {
+			pthread_cond_signal(&base64_pool_done);
+		}
+	}
+	pthread_mutex_unlock(&base64_pool_lock);
+	return NULL;
+}
+
+// Run a job on the calling thread and up to `nthreads - 1` workers:
+static void
+base64_pool_run (struct base64_job *job, int nthreads)
+{
+	int wanted = nthreads - 1;
+	size_t *order;
+
+	if ((size_t) wanted > job->nchunks - 1) {
+		wanted = (int) (job->nchunks - 1);
+	}
+	if (wanted > BASE64_POOL_MAX) {
+		wanted = BASE64_POOL_MAX;
+	}
+
+	pthread_mutex_lock(&base64_pool_busy);
+	pthread_mutex_lock(&base64_pool_lock);
+
+	if (base64_pool_nodes == 0) {
+		base64_pool_topology();
+	}
+
+	// Start the missing workers. If the system refuses, make do with the
+	// workers there are:
+	base64_pool_stop = 0;
+	base64_pool_started = base64_pool_generation;
+	while (base64_pool_size < wanted) {
+		if (pthread_create(&base64_pool_threads[base64_pool_size], NULL, base64_pool_worker, (void *) (intptr_t) base64_pool_size) != 0) {
+			wanted = base64_pool_size;
+			break;
+		}
+		base64_pool_size++;
+	}
+
+	// Post the job:
+	order = base64_pool_lanes(job);
+	base64_pool_job = job;
+	base64_pool_wanted = wanted;
+	base64_pool_active = wanted;
+	base64_pool_generation++;
+	pthread_cond_broadcast(&base64_pool_wake);
+	pthread_mutex_unlock(&base64_pool_lock);
+
+	base64_job_work(job, base64_pool_node());
+
+	// Wait for the workers to finish their last chunks:
+	pthread_mutex_lock(&base64_pool_lock);
+	while (base64_pool_active > 0) {
+		pthread_cond_wait(&base64_pool_done, &base64_pool_lock);
+	}
+	base64_pool_job = NULL;
+	pthread_mutex_unlock(&base64_pool_lock);
+	pthread_mutex_unlock(&base64_pool_busy);
+	free(order);
+}
+
+// The number of threads to use when the caller leaves it to the library:
+static int
+base64_pool_threads_default (void)
+{
+	const long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (n < 1) ? 1 : (n > BASE64_POOL_MAX + 1) ? BASE64_POOL_MAX + 1 : (int) n;
+}
+
+void
+base64_mt_shutdown (void)
+{
+	int i;
+
+	pthread_mutex_lock(&base64_pool_busy);
+	pthread_mutex_lock(&base64_pool_lock);
+	base64_pool_stop = 1;
+	pthread_cond_broadcast(&base64_pool_wake);
+	pthread_mutex_unlock(&base64_pool_lock);
+
+	for (i = 0; i < base64_pool_size; i++) {
+		pthread_join(base64_pool_threads[i], NULL);
+	}
+	base64_pool_size = 0;
+	pthread_mutex_unlock(&base64_pool_busy);
+}
+
+void
+base64_mt_set_pinning (int pin)
+{
+	pthread_mutex_lock(&base64_pool_lock);
+	base64_pool_pin = (pin != 0);
+	pthread_mutex_unlock(&base64_pool_lock);
+}
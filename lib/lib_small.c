@@ -0,0 +1,167 @@
+// Short inputs, such as keys, nonces, digests and tokens, are encoded and
+// decoded in a single pass with the 12-bit and 32-bit tables of the generic
+// codecs, without a stream state. This skips the setup of the stream, and the
+// preconditions of the SIMD loops that would fail on such inputs anyway.
+//
+// The decoder only takes well-formed input. On anything else it gives up, and
+// the caller decodes the input again on the regular path, which does the error
+// reporting.
+
+static inline void
+base64_encode_small
+	( const struct base64_tables	*tables
+	, const uint8_t			*src
+	, size_t			 srclen
+	, uint8_t			*out
+	, size_t			*outlen
+	, int				 flags
+	)
+{
+	const uint16_t *table = tables->enc_12bit;
+	uint8_t *o = out;
+
+#if BASE64_WORDSIZE >= 64
+	// Encode six bytes at a time with four 12-bit lookups, as long as
+	// eight bytes can be loaded:
+	for (; srclen >= 8; srclen -= 6) {
+		uint64_t n;
+
+		memcpy(&n, src, sizeof (n));
+		n = BASE64_HTOBE64(n);
+
+		memcpy(o + 0, table + ((n >> 52) & 0xFFFU), 2);
+		memcpy(o + 2, table + ((n >> 40) & 0xFFFU), 2);
+		memcpy(o + 4, table + ((n >> 28) & 0xFFFU), 2);
+		memcpy(o + 6, table + ((n >> 16) & 0xFFFU), 2);
+
+		src += 6;
+		o   += 8;
+	}
+#endif
+
+	// Then three bytes at a time, with the bytes loaded one by one:
+	for (; srclen >= 3; srclen -= 3) {
+		const uint32_t n = (uint32_t) src[0] << 16 | (uint32_t) src[1] << 8 | src[2];
+
+		memcpy(o + 0, table + (n >> 12),    2);
+		memcpy(o + 2, table + (n & 0xFFFU), 2);
+
+		src += 3;
+		o   += 4;
+	}
+
+	// Encode the last one or two bytes, and add the end-of-stream markers
+	// unless padding was disabled or the alphabet has none:
+	if (srclen > 0) {
+		const int pad = !(flags & (BASE64_NOPAD | BASE64_FORBID_PAD)) && tables->pad != 0;
+		const uint32_t n = (uint32_t) src[0] << 16 | ((srclen == 2) ? (uint32_t) src[1] << 8 : 0);
+
+		*o++ = tables->enc_6bit[n >> 18];
+		*o++ = tables->enc_6bit[(n >> 12) & 0x3F];
+
+		if (srclen == 2) {
+			*o++ = tables->enc_6bit[(n >> 6) & 0x3F];
+		} else if (pad) {
+			*o++ = tables->pad;
+		}
+		if (pad) {
+			*o++ = tables->pad;
+		}
+	}
+	*outlen = (size_t) (o - out);
+}
+
+static inline int
+base64_decode_small
+	( const struct base64_tables	*tables
+	, const uint8_t			*src
+	, size_t			 srclen
+	, uint8_t			*out
+	, size_t			*outlen
+	, int				 flags
+	)
+{
+	const uint32_t *d0 = tables->dec_32bit_d0;
+	const uint32_t *d1 = tables->dec_32bit_d1;
+	const uint32_t *d2 = tables->dec_32bit_d2;
+	const uint32_t *d3 = tables->dec_32bit_d3;
+	const uint8_t *d = tables->dec_8bit;
+	uint8_t *o = out;
+
+	if (srclen == 0) {
+		*outlen = 0;
+		return 1;
+	}
+
+	// The last quad, which may be padded or short, is done separately:
+	const size_t tail = (srclen % 4 == 0) ? 4 : srclen % 4;
+	const uint8_t *end = src + srclen - tail;
+
+	if (tail == 1) {
+		return 0;
+	}
+
+	// Decode the whole quads before it with the 32-bit tables. The fourth
+	// byte that is stored is a zero, which is overwritten by the next quad
+	// or by the last one, which yields at least one byte:
+	for (; src < end; src += 4) {
+		const uint32_t str = d0[src[0]] | d1[src[1]] | d2[src[2]] | d3[src[3]];
+
+#if BASE64_LITTLE_ENDIAN
+		if (str & UINT32_C(0x80000000)) {
+			return 0;
+		}
+#else
+		if (str & UINT32_C(1)) {
+			return 0;
+		}
+#endif
+		memcpy(o, &str, sizeof (str));
+		o += 3;
+	}
+
+	// Translate the last quad, and find out how many characters precede
+	// the padding, if any:
+	const uint8_t c0 = d[src[0]];
+	const uint8_t c1 = d[src[1]];
+	uint8_t c2 = (tail > 2) ? d[src[2]] : 0;
+	uint8_t c3 = (tail > 3) ? d[src[3]] : 0;
+	size_t chars = tail;
+
+	if (tail == 4 && c3 == 254) {
+		chars = (c2 == 254) ? 2 : 3;
+		c3 = 0;
+		if (chars == 2) {
+			c2 = 0;
+		}
+	}
+	if ((c0 | c1 | c2 | c3) >= 64) {
+		return 0;
+	}
+
+	// The unused bits of the last character must pass the policy, which
+	// also decides whether the padding may be present or absent:
+	if (chars < 4) {
+		const unsigned char carry = (chars == 2) ? (c1 & 0x0F) : (c2 & 0x03);
+
+		if (chars < tail) {
+			if (!base64_pad_allowed(flags, carry)) {
+				return 0;
+			}
+		} else if (!base64_pad_optional(flags, tables) || ((flags & BASE64_STRICT) && carry != 0)) {
+			return 0;
+		}
+	}
+
+	const uint32_t n = (uint32_t) c0 << 18 | (uint32_t) c1 << 12 | (uint32_t) c2 << 6 | c3;
+
+	*o++ = (uint8_t) (n >> 16);
+	if (chars > 2) {
+		*o++ = (uint8_t) (n >> 8);
+	}
+	if (chars > 3) {
+		*o++ = (uint8_t) n;
+	}
+	*outlen = (size_t) (o - out);
+	return 1;
+}
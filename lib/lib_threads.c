@@ -0,0 +1,294 @@
+// The multi-threaded functions, on the pool of lib_pool.c. The input is cut
+// into chunks that fit in the L2 cache together with their output. The tail
+// of the input, which may hold a partial group and the padding, is done by
+// the calling thread once all chunks are done.
+
+// The chunks are whole groups on both sides, 64 KiB of encoded characters:
+#define BASE64_POOL_ENC_CHUNK	(48 * 1024)
+#define BASE64_POOL_DEC_CHUNK	(64 * 1024)
+
+// Whether the codec is compiled in. A codec that is not has a decoder stub,
+// which fails even on empty input:
+static inline int
+base64_pool_codec_ok (const struct base64_codec *codec, int flags)
+{
+	struct base64_state state;
+	char c = 0;
+	size_t n;
+
+	base64_state_init(&state, flags, codec);
+	return codec->dec(&state, &c, 0, &c, &n) != -1;
+}
+
+static void
+base64_job_encode (struct base64_job *job, size_t chunk)
+{
+	const size_t off = chunk * BASE64_POOL_ENC_CHUNK;
+	const size_t len = (job->srclen - off < BASE64_POOL_ENC_CHUNK) ? job->srclen - off : BASE64_POOL_ENC_CHUNK;
+	struct base64_state state;
+	size_t n;
+
+	base64_state_init(&state, job->flags, job->codec);
+	state.alphabet = job->alphabet;
+	job->codec->enc(&state, job->src + off, len, job->out + off / 3 * 4, &n);
+}
+
+// A chunk decodes to three bytes per quad, or it is invalid. Padding is only
+// valid in the tail, which makes the output short:
+static void
+base64_job_decode (struct base64_job *job, size_t chunk)
+{
+	const size_t off = chunk * BASE64_POOL_DEC_CHUNK;
+	struct base64_state state;
+	size_t n;
+
+	base64_state_init(&state, job->flags, job->codec);
+	state.alphabet = job->alphabet;
+
+	if (job->codec->dec(&state, job->src + off, BASE64_POOL_DEC_CHUNK, job->out + off / 4 * 3, &n) != 1
+	 || n != BASE64_POOL_DEC_CHUNK / 4 * 3) {
+		base64_job_fail(job, chunk, n);
+	}
+}
+
+// The chunks are too small for the encoders to tell that the whole output is
+// too large for the cache, so they are told:
+static inline int
+base64_mt_enc_flags (int flags, size_t srclen)
+{
+	return (srclen >= BASE64_NONTEMPORAL_SIZE) ? flags | BASE64_NONTEMPORAL : flags;
+}
+
+void
+base64_encode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	)
+{
+	struct base64_job job;
+	struct base64_state state;
+	size_t body, s, t;
+
+	if (nthreads <= 0) {
+		nthreads = base64_pool_threads_default();
+	}
+
+	// The chunks cover the whole groups of the input:
+	job.codec    = base64_codec_get(flags);
+	job.alphabet = NULL;
+	job.src      = src;
+	job.out      = out;
+	job.srclen   = body = srclen / 3 * 3;
+	job.chunk    = BASE64_POOL_ENC_CHUNK;
+	job.nchunks  = (body + BASE64_POOL_ENC_CHUNK - 1) / BASE64_POOL_ENC_CHUNK;
+	job.failed   = job.nchunks;
+	job.flags    = base64_mt_enc_flags(flags, srclen);
+	job.run      = base64_job_encode;
+
+	// A codec that is not available is left to the plain call:
+	if (nthreads == 1 || job.nchunks < 2 || srclen < base64_parallel_cutoff(BASE64_PARALLEL_POOL, job.codec, 0)
+	 || !base64_pool_codec_ok(job.codec, flags)) {
+		base64_encode(src, srclen, out, outlen, flags);
+		return;
+	}
+	base64_pool_run(&job, nthreads);
+
+	// Encode the remaining bytes and write the trailer:
+	base64_state_init(&state, flags, job.codec);
+	job.codec->enc(&state, src + body, srclen - body, out + body / 3 * 4, &s);
+	t = base64_encode_trailer(&state, (uint8_t *) out + body / 3 * 4 + s);
+
+	*outlen = body / 3 * 4 + s + t;
+}
+
+// The offset of the first error in `srclen` bytes of input that failed to
+// decode from a fresh state. Input that is valid on its own ends in padding,
+// so the error is the byte after it:
+static inline size_t
+base64_mt_error (const char *src, size_t srclen, int flags)
+{
+	size_t at;
+
+	return base64_validate(src, srclen, flags, NULL, &at) ? srclen : at;
+}
+
+int
+base64_decode_mt
+	( const char	*src
+	, size_t	 srclen
+	, char		*out
+	, size_t	*outlen
+	, int		 flags
+	, int		 nthreads
+	, size_t	*error_offset
+	)
+{
+	struct base64_job job;
+	struct base64_state state;
+	size_t body, s;
+	int ret;
+
+	if (nthreads <= 0) {
+		nthreads = base64_pool_threads_default();
+	}
+	if (error_offset != NULL) {
+		*error_offset = srclen;
+	}
+
+	// The chunks leave at least one character to the tail, which holds the
+	// last quad and its padding, if any:
+	job.codec    = base64_codec_get(flags);
+	job.alphabet = NULL;
+	job.src      = src;
+	job.out      = out;
+	job.srclen   = srclen;
+	job.chunk    = BASE64_POOL_DEC_CHUNK;
+	job.nchunks  = (srclen > 0) ? (srclen - 1) / BASE64_POOL_DEC_CHUNK : 0;
+	job.failed   = job.nchunks;
+	job.flags    = flags;
+	job.run      = base64_job_decode;
+
+	// The input cannot be split on quad boundaries when bytes are skipped.
+	// A codec that is not available is reported by the plain call:
+	if (nthreads == 1 || job.nchunks < 2 || (flags & (BASE64_IGNORE_SPACE | BASE64_FORGIVING))
+	 || srclen < base64_parallel_cutoff(BASE64_PARALLEL_POOL, job.codec, 1)
+	 || !base64_pool_codec_ok(job.codec, flags)) {
+		ret = base64_decode(src, srclen, out, outlen, flags);
+		if (ret == 0 && error_offset != NULL) {
+			*error_offset = base64_mt_error(src, srclen, flags);
+		}
+		return ret;
+	}
+	base64_pool_run(&job, nthreads);
+
+	// On error, report the output up to the first invalid chunk, and the
+	// error in it. The chunks before it are valid, so that it starts from
+	// a fresh state:
+	if (job.failed < job.nchunks) {
+		body = job.failed * BASE64_POOL_DEC_CHUNK;
+		*outlen = body / 4 * 3 + job.failed_len;
+		if (error_offset != NULL) {
+			*error_offset = body + base64_mt_error(src + body, BASE64_POOL_DEC_CHUNK, flags);
+		}
+		return 0;
+	}
+
+	// Decode the tail:
+	body = job.nchunks * BASE64_POOL_DEC_CHUNK;
+	base64_state_init(&state, flags, job.codec);
+	ret = job.codec->dec(&state, src + body, srclen - body, out + body / 4 * 3, &s);
+	*outlen = body / 4 * 3 + s;
+
+	if (ret == 1 && base64_stream_decode_complete(&state)) {
+		return 1;
+	}
+	if (error_offset != NULL) {
+		*error_offset = body + base64_mt_error(src + body, srclen - body, flags);
+	}
+	return 0;
+}
+
+// The stream functions split a large call across the pool once the state is
+// at a group boundary. The bytes before that boundary complete the group in
+// the state, and the bytes after the last chunk go through the state as
+// usual, so that the carry is only handled at the edges of the call:
+static void
+base64_stream_encode_threads
+	( struct base64_state	*state
+	, const char		*src
+	, size_t		 srclen
+	, char			*out
+	, size_t		*outlen
+	)
+{
+	struct base64_job job;
+	size_t head, body, s, t;
+
+	// Complete the group in the state:
+	head = (3 - (size_t) state->bytes) % 3;
+	if (head > srclen) {
+		head = srclen;
+	}
+	state->codec->enc(state, src, head, out, &s);
+	src    += head;
+	srclen -= head;
+
+	job.codec    = state->codec;
+	job.alphabet = state->alphabet;
+	job.src      = src;
+	job.out      = out + s;
+	job.srclen   = body = srclen / 3 * 3;
+	job.chunk    = BASE64_POOL_ENC_CHUNK;
+	job.nchunks  = (body + BASE64_POOL_ENC_CHUNK - 1) / BASE64_POOL_ENC_CHUNK;
+	job.failed   = job.nchunks;
+	job.flags    = base64_mt_enc_flags(state->flags, srclen);
+	job.run      = base64_job_encode;
+
+	if (job.nchunks < 2 || srclen < base64_parallel_cutoff(BASE64_PARALLEL_POOL, job.codec, 0)
+	 || !base64_pool_codec_ok(job.codec, job.flags)) {
+		body = 0;
+	}
+	else {
+		base64_pool_run(&job, (state->threads > 0) ? state->threads : base64_pool_threads_default());
+	}
+
+	// Leave the remaining bytes in the state:
+	state->codec->enc(state, src + body, srclen - body, out + s + body / 3 * 4, &t);
+	*outlen = s + body / 3 * 4 + t;
+}
+
+static int
+base64_stream_decode_threads
+	( struct base64_state	*state
+	, const char		*src
+	, size_t		 srclen
+	, char			*out
+	, size_t		*outlen
+	)
+{
+	struct base64_job job;
+	size_t head, body, s, t;
+	int ret;
+
+	// Complete the quad in the state:
+	head = (4 - (size_t) state->bytes) % 4;
+	if (head > srclen) {
+		head = srclen;
+	}
+	if ((ret = state->codec->dec(state, src, head, out, &s)) != 1) {
+		*outlen = s;
+		return ret;
+	}
+	src    += head;
+	srclen -= head;
+
+	// The chunks leave at least one character to the state, which may be
+	// the padding:
+	job.codec    = state->codec;
+	job.alphabet = state->alphabet;
+	job.src      = src;
+	job.out      = out + s;
+	job.srclen   = srclen;
+	job.chunk    = BASE64_POOL_DEC_CHUNK;
+	job.nchunks  = (srclen > 0) ? (srclen - 1) / BASE64_POOL_DEC_CHUNK : 0;
+	job.failed   = job.nchunks;
+	job.flags    = state->flags;
+	job.run      = base64_job_decode;
+
+	body = 0;
+	if (state->eof == 0 && job.nchunks >= 2 && srclen >= base64_parallel_cutoff(BASE64_PARALLEL_POOL, job.codec, 1)) {
+		base64_pool_run(&job, (state->threads > 0) ? state->threads : base64_pool_threads_default());
+
+		// The chunks before the first invalid one are valid. The rest,
+		// which holds the error, goes through the state, so that the
+		// result is that of a single thread:
+		body = job.failed * BASE64_POOL_DEC_CHUNK;
+	}
+	ret = state->codec->dec(state, src + body, srclen - body, out + s + body / 4 * 3, &t);
+	*outlen = s + body / 4 * 3 + t;
+	return ret;
+}
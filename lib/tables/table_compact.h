@@ -0,0 +1,281 @@
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t base64_table_compact[256][8] = {
+	{ 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 1, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 0, 0, 0, 0, 0, 0 },
+	{ 2, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 0, 0, 0, 0, 0, 0 },
+	{ 1, 2, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 0, 0, 0, 0, 0 },
+	{ 3, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 0, 0, 0, 0, 0, 0 },
+	{ 1, 3, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 3, 0, 0, 0, 0, 0 },
+	{ 2, 3, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 3, 0, 0, 0, 0, 0 },
+	{ 1, 2, 3, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 3, 0, 0, 0, 0 },
+	{ 4, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 4, 0, 0, 0, 0, 0, 0 },
+	{ 1, 4, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 4, 0, 0, 0, 0, 0 },
+	{ 2, 4, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 4, 0, 0, 0, 0, 0 },
+	{ 1, 2, 4, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 4, 0, 0, 0, 0 },
+	{ 3, 4, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 4, 0, 0, 0, 0, 0 },
+	{ 1, 3, 4, 0, 0, 0, 0, 0 },
+	{ 0, 1, 3, 4, 0, 0, 0, 0 },
+	{ 2, 3, 4, 0, 0, 0, 0, 0 },
+	{ 0, 2, 3, 4, 0, 0, 0, 0 },
+	{ 1, 2, 3, 4, 0, 0, 0, 0 },
+	{ 0, 1, 2, 3, 4, 0, 0, 0 },
+	{ 5, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 5, 0, 0, 0, 0, 0, 0 },
+	{ 1, 5, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 5, 0, 0, 0, 0, 0 },
+	{ 2, 5, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 5, 0, 0, 0, 0, 0 },
+	{ 1, 2, 5, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 5, 0, 0, 0, 0 },
+	{ 3, 5, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 5, 0, 0, 0, 0, 0 },
+	{ 1, 3, 5, 0, 0, 0, 0, 0 },
+	{ 0, 1, 3, 5, 0, 0, 0, 0 },
+	{ 2, 3, 5, 0, 0, 0, 0, 0 },
+	{ 0, 2, 3, 5, 0, 0, 0, 0 },
+	{ 1, 2, 3, 5, 0, 0, 0, 0 },
+	{ 0, 1, 2, 3, 5, 0, 0, 0 },
+	{ 4, 5, 0, 0, 0, 0, 0, 0 },
+	{ 0, 4, 5, 0, 0, 0, 0, 0 },
+	{ 1, 4, 5, 0, 0, 0, 0, 0 },
+	{ 0, 1, 4, 5, 0, 0, 0, 0 },
+	{ 2, 4, 5, 0, 0, 0, 0, 0 },
+	{ 0, 2, 4, 5, 0, 0, 0, 0 },
+	{ 1, 2, 4, 5, 0, 0, 0, 0 },
+	{ 0, 1, 2, 4, 5, 0, 0, 0 },
+	{ 3, 4, 5, 0, 0, 0, 0, 0 },
+	{ 0, 3, 4, 5, 0, 0, 0, 0 },
+	{ 1, 3, 4, 5, 0, 0, 0, 0 },
+	{ 0, 1, 3, 4, 5, 0, 0, 0 },
+	{ 2, 3, 4, 5, 0, 0, 0, 0 },
+	{ 0, 2, 3, 4, 5, 0, 0, 0 },
+	{ 1, 2, 3, 4, 5, 0, 0, 0 },
+	{ 0, 1, 2, 3, 4, 5, 0, 0 },
+	{ 6, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 6, 0, 0, 0, 0, 0, 0 },
+	{ 1, 6, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 6, 0, 0, 0, 0, 0 },
+	{ 2, 6, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 6, 0, 0, 0, 0, 0 },
+	{ 1, 2, 6, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 6, 0, 0, 0, 0 },
+	{ 3, 6, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 6, 0, 0, 0, 0, 0 },
+	{ 1, 3, 6, 0, 0, 0, 0, 0 },
+	{ 0, 1, 3, 6, 0, 0, 0, 0 },
+	{ 2, 3, 6, 0, 0, 0, 0, 0 },
+	{ 0, 2, 3, 6, 0, 0, 0, 0 },
+	{ 1, 2, 3, 6, 0, 0, 0, 0 },
+	{ 0, 1, 2, 3, 6, 0, 0, 0 },
+	{ 4, 6, 0, 0, 0, 0, 0, 0 },
+	{ 0, 4, 6, 0, 0, 0, 0, 0 },
+	{ 1, 4, 6, 0, 0, 0, 0, 0 },
+	{ 0, 1, 4, 6, 0, 0, 0, 0 },
+	{ 2, 4, 6, 0, 0, 0, 0, 0 },
+	{ 0, 2, 4, 6, 0, 0, 0, 0 },
+	{ 1, 2, 4, 6, 0, 0, 0, 0 },
+	{ 0, 1, 2, 4, 6, 0, 0, 0 },
+	{ 3, 4, 6, 0, 0, 0, 0, 0 },
+	{ 0, 3, 4, 6, 0, 0, 0, 0 },
+	{ 1, 3, 4, 6, 0, 0, 0, 0 },
+	{ 0, 1, 3, 4, 6, 0, 0, 0 },
+	{ 2, 3, 4, 6, 0, 0, 0, 0 },
+	{ 0, 2, 3, 4, 6, 0, 0, 0 },
+	{ 1, 2, 3, 4, 6, 0, 0, 0 },
+	{ 0, 1, 2, 3, 4, 6, 0, 0 },
+	{ 5, 6, 0, 0, 0, 0, 0, 0 },
+	{ 0, 5, 6, 0, 0, 0, 0, 0 },
+	{ 1, 5, 6, 0, 0, 0, 0, 0 },
+	{ 0, 1, 5, 6, 0, 0, 0, 0 },
+	{ 2, 5, 6, 0, 0, 0, 0, 0 },
+	{ 0, 2, 5, 6, 0, 0, 0, 0 },
+	{ 1, 2, 5, 6, 0, 0, 0, 0 },
+	{ 0, 1, 2, 5, 6, 0, 0, 0 },
+	{ 3, 5, 6, 0, 0, 0, 0, 0 },
+	{ 0, 3, 5, 6, 0, 0, 0, 0 },
+	{ 1, 3, 5, 6, 0, 0, 0, 0 },
+	{ 0, 1, 3, 5, 6, 0, 0, 0 },
+	{ 2, 3, 5, 6, 0, 0, 0, 0 },
+	{ 0, 2, 3, 5, 6, 0, 0, 0 },
+	{ 1, 2, 3, 5, 6, 0, 0, 0 },
+	{ 0, 1, 2, 3, 5, 6, 0, 0 },
+	{ 4, 5, 6, 0, 0, 0, 0, 0 },
+	{ 0, 4, 5, 6, 0, 0, 0, 0 },
+	{ 1, 4, 5, 6, 0, 0, 0, 0 },
+	{ 0, 1, 4, 5, 6, 0, 0, 0 },
+	{ 2, 4, 5, 6, 0, 0, 0, 0 },
+	{ 0, 2, 4, 5, 6, 0, 0, 0 },
+	{ 1, 2, 4, 5, 6, 0, 0, 0 },
+	{ 0, 1, 2, 4, 5, 6, 0, 0 },
+	{ 3, 4, 5, 6, 0, 0, 0, 0 },
+	{ 0, 3, 4, 5, 6, 0, 0, 0 },
+	{ 1, 3, 4, 5, 6, 0, 0, 0 },
+	{ 0, 1, 3, 4, 5, 6, 0, 0 },
+	{ 2, 3, 4, 5, 6, 0, 0, 0 },
+	{ 0, 2, 3, 4, 5, 6, 0, 0 },
+	{ 1, 2, 3, 4, 5, 6, 0, 0 },
+	{ 0, 1, 2, 3, 4, 5, 6, 0 },
+	{ 7, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 7, 0, 0, 0, 0, 0, 0 },
+	{ 1, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 1, 7, 0, 0, 0, 0, 0 },
+	{ 2, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 2, 7, 0, 0, 0, 0, 0 },
+	{ 1, 2, 7, 0, 0, 0, 0, 0 },
+	{ 0, 1, 2, 7, 0, 0, 0, 0 },
+	{ 3, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 7, 0, 0, 0, 0, 0 },
+	{ 1, 3, 7, 0, 0, 0, 0, 0 },
+	{ 0, 1, 3, 7, 0, 0, 0, 0 },
+	{ 2, 3, 7, 0, 0, 0, 0, 0 },
+	{ 0, 2, 3, 7, 0, 0, 0, 0 },
+	{ 1, 2, 3, 7, 0, 0, 0, 0 },
+	{ 0, 1, 2, 3, 7, 0, 0, 0 },
+	{ 4, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 4, 7, 0, 0, 0, 0, 0 },
+	{ 1, 4, 7, 0, 0, 0, 0, 0 },
+	{ 0, 1, 4, 7, 0, 0, 0, 0 },
+	{ 2, 4, 7, 0, 0, 0, 0, 0 },
+	{ 0, 2, 4, 7, 0, 0, 0, 0 },
+	{ 1, 2, 4, 7, 0, 0, 0, 0 },
+	{ 0, 1, 2, 4, 7, 0, 0, 0 },
+	{ 3, 4, 7, 0, 0, 0, 0, 0 },
+	{ 0, 3, 4, 7, 0, 0, 0, 0 },
+	{ 1, 3, 4, 7, 0, 0, 0, 0 },
+	{ 0, 1, 3, 4, 7, 0, 0, 0 },
+	{ 2, 3, 4, 7, 0, 0, 0, 0 },
+	{ 0, 2, 3, 4, 7, 0, 0, 0 },
+	{ 1, 2, 3, 4, 7, 0, 0, 0 },
+	{ 0, 1, 2, 3, 4, 7, 0, 0 },
+	{ 5, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 5, 7, 0, 0, 0, 0, 0 },
+	{ 1, 5, 7, 0, 0, 0, 0, 0 },
+	{ 0, 1, 5, 7, 0, 0, 0, 0 },
+	{ 2, 5, 7, 0, 0, 0, 0, 0 },
+	{ 0, 2, 5, 7, 0, 0, 0, 0 },
+	{ 1, 2, 5, 7, 0, 0, 0, 0 },
+	{ 0, 1, 2, 5, 7, 0, 0, 0 },
+	{ 3, 5, 7, 0, 0, 0, 0, 0 },
+	{ 0, 3, 5, 7, 0, 0, 0, 0 },
+	{ 1, 3, 5, 7, 0, 0, 0, 0 },
+	{ 0, 1, 3, 5, 7, 0, 0, 0 },
+	{ 2, 3, 5, 7, 0, 0, 0, 0 },
+	{ 0, 2, 3, 5, 7, 0, 0, 0 },
+	{ 1, 2, 3, 5, 7, 0, 0, 0 },
+	{ 0, 1, 2, 3, 5, 7, 0, 0 },
+	{ 4, 5, 7, 0, 0, 0, 0, 0 },
+	{ 0, 4, 5, 7, 0, 0, 0, 0 },
+	{ 1, 4, 5, 7, 0, 0, 0, 0 },
+	{ 0, 1, 4, 5, 7, 0, 0, 0 },
+	{ 2, 4, 5, 7, 0, 0, 0, 0 },
+	{ 0, 2, 4, 5, 7, 0, 0, 0 },
+	{ 1, 2, 4, 5, 7, 0, 0, 0 },
+	{ 0, 1, 2, 4, 5, 7, 0, 0 },
+	{ 3, 4, 5, 7, 0, 0, 0, 0 },
+	{ 0, 3, 4, 5, 7, 0, 0, 0 },
+	{ 1, 3, 4, 5, 7, 0, 0, 0 },
+	{ 0, 1, 3, 4, 5, 7, 0, 0 },
+	{ 2, 3, 4, 5, 7, 0, 0, 0 },
+	{ 0, 2, 3, 4, 5, 7, 0, 0 },
+	{ 1, 2, 3, 4, 5, 7, 0, 0 },
+	{ 0, 1, 2, 3, 4, 5, 7, 0 },
+	{ 6, 7, 0, 0, 0, 0, 0, 0 },
+	{ 0, 6, 7, 0, 0, 0, 0, 0 },
+	{ 1, 6, 7, 0, 0, 0, 0, 0 },
+	{ 0, 1, 6, 7, 0, 0, 0, 0 },
+	{ 2, 6, 7, 0, 0, 0, 0, 0 },
+	{ 0, 2, 6, 7, 0, 0, 0, 0 },
+	{ 1, 2, 6, 7, 0, 0, 0, 0 },
+	{ 0, 1, 2, 6, 7, 0, 0, 0 },
+	{ 3, 6, 7, 0, 0, 0, 0, 0 },
+	{ 0, 3, 6, 7, 0, 0, 0, 0 },
+	{ 1, 3, 6, 7, 0, 0, 0, 0 },
+	{ 0, 1, 3, 6, 7, 0, 0, 0 },
+	{ 2, 3, 6, 7, 0, 0, 0, 0 },
+	{ 0, 2, 3, 6, 7, 0, 0, 0 },
+	{ 1, 2, 3, 6, 7, 0, 0, 0 },
+	{ 0, 1, 2, 3, 6, 7, 0, 0 },
+	{ 4, 6, 7, 0, 0, 0, 0, 0 },
+	{ 0, 4, 6, 7, 0, 0, 0, 0 },
+	{ 1, 4, 6, 7, 0, 0, 0, 0 },
+	{ 0, 1, 4, 6, 7, 0, 0, 0 },
+	{ 2, 4, 6, 7, 0, 0, 0, 0 },
+	{ 0, 2, 4, 6, 7, 0, 0, 0 },
+	{ 1, 2, 4, 6, 7, 0, 0, 0 },
+	{ 0, 1, 2, 4, 6, 7, 0, 0 },
+	{ 3, 4, 6, 7, 0, 0, 0, 0 },
+	{ 0, 3, 4, 6, 7, 0, 0, 0 },
+	{ 1, 3, 4, 6, 7, 0, 0, 0 },
+	{ 0, 1, 3, 4, 6, 7, 0, 0 },
+	{ 2, 3, 4, 6, 7, 0, 0, 0 },
+	{ 0, 2, 3, 4, 6, 7, 0, 0 },
+	{ 1, 2, 3, 4, 6, 7, 0, 0 },
+	{ 0, 1, 2, 3, 4, 6, 7, 0 },
+	{ 5, 6, 7, 0, 0, 0, 0, 0 },
+	{ 0, 5, 6, 7, 0, 0, 0, 0 },
+	{ 1, 5, 6, 7, 0, 0, 0, 0 },
+	{ 0, 1, 5, 6, 7, 0, 0, 0 },
+	{ 2, 5, 6, 7, 0, 0, 0, 0 },
+	{ 0, 2, 5, 6, 7, 0, 0, 0 },
+	{ 1, 2, 5, 6, 7, 0, 0, 0 },
+	{ 0, 1, 2, 5, 6, 7, 0, 0 },
+	{ 3, 5, 6, 7, 0, 0, 0, 0 },
+	{ 0, 3, 5, 6, 7, 0, 0, 0 },
+	{ 1, 3, 5, 6, 7, 0, 0, 0 },
+	{ 0, 1, 3, 5, 6, 7, 0, 0 },
+	{ 2, 3, 5, 6, 7, 0, 0, 0 },
+	{ 0, 2, 3, 5, 6, 7, 0, 0 },
+	{ 1, 2, 3, 5, 6, 7, 0, 0 },
+	{ 0, 1, 2, 3, 5, 6, 7, 0 },
+	{ 4, 5, 6, 7, 0, 0, 0, 0 },
+	{ 0, 4, 5, 6, 7, 0, 0, 0 },
+	{ 1, 4, 5, 6, 7, 0, 0, 0 },
+	{ 0, 1, 4, 5, 6, 7, 0, 0 },
+	{ 2, 4, 5, 6, 7, 0, 0, 0 },
+	{ 0, 2, 4, 5, 6, 7, 0, 0 },
+	{ 1, 2, 4, 5, 6, 7, 0, 0 },
+	{ 0, 1, 2, 4, 5, 6, 7, 0 },
+	{ 3, 4, 5, 6, 7, 0, 0, 0 },
+	{ 0, 3, 4, 5, 6, 7, 0, 0 },
+	{ 1, 3, 4, 5, 6, 7, 0, 0 },
+	{ 0, 1, 3, 4, 5, 6, 7, 0 },
+	{ 2, 3, 4, 5, 6, 7, 0, 0 },
+	{ 0, 2, 3, 4, 5, 6, 7, 0 },
+	{ 1, 2, 3, 4, 5, 6, 7, 0 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+};
+
+const uint8_t base64_table_compact_len[256] = {
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+	4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8,
+};
@@ -0,0 +1,44 @@
+#!/usr/bin/python3
+
+# The shuffle tables of the SIMD ignore loops. For each 8-bit mask of lanes
+# to keep, the first table lists the kept lanes in order, padded with zeros,
+# and the second table counts them.
+
+def table_compact():
+    """Generate the lane indices of each mask."""
+    ret = []
+    for n in range(0, 2**8):
+        lanes = [i for i in range(8) if n & (1 << i)]
+        lanes += [0] * (8 - len(lanes))
+        ret.append("\t{{ {} }},".format(", ".join(str(i) for i in lanes)))
+    return "\n".join(ret)
+
+def table_count():
+    """Generate the number of lanes of each mask."""
+    ret = []
+    for n in range(0, 2**8):
+        pre = "\n\t" if n % 16 == 0 else " "
+        pre = "\t" if n == 0 else pre
+        ret.append("{}{},".format(pre, bin(n).count('1')))
+    return "".join(ret)
+
+def main():
+    """Entry point."""
+    lines = [
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "const uint8_t base64_table_compact[256][8] = {",
+        table_compact(),
+        "};",
+        "",
+        "const uint8_t base64_table_compact_len[256] = {",
+        table_count(),
+        "};"
+    ]
+    for line in lines:
+        print(line)
+
+if __name__ == "__main__":
+    main()
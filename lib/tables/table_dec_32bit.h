@@ -1,9 +1,7 @@
 #pragma once
 
 #include <stdint.h>
-#define CHAR62 '+'
-#define CHAR63 '/'
-#define CHARPAD '='
+/* CHAR62 '+', CHAR63 '/', CHARPAD '=' */
 
 
 #if BASE64_LITTLE_ENDIAN
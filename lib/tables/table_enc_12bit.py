@@ -1,11 +1,18 @@
 #!/usr/bin/python3
 
+import sys
+
+# The last two characters of the alphabet and the name of the table can be
+# overridden on the command line, e.g. `table_enc_12bit.py -_ url`:
+CHARS = sys.argv[1] if len(sys.argv) > 1 else '+/'
+NAME = 'base64_table_enc_12bit' + ('_' + sys.argv[2] if len(sys.argv) > 2 else '')
+
 def tr(x):
     """Translate a 6-bit value to the Base64 alphabet."""
     s = 'ABCDEFGHIJKLMNOPQRSTUVWXYZ' \
       + 'abcdefghijklmnopqrstuvwxyz' \
       + '0123456789' \
-      + '+/'
+      + CHARS
     return ord(s[x])
 
 def table(fn):
@@ -30,7 +37,7 @@ def main():
     lines = [
         "#include <stdint.h>",
         "",
-        "const uint16_t base64_table_enc_12bit[] = {",
+        "const uint16_t {}[] = {{".format(NAME),
         "#if BASE64_LITTLE_ENDIAN",
         table_le(),
         "#else",
@@ -49,12 +49,12 @@ static uint8_t b64chars[64] = {
 
 static uint8_t padchar = '=';
 
+static const char *tablename = "base64_table_dec_32bit";
+
 static void printStart(void)
 {
 	printf("#include <stdint.h>\n");
-	printf("#define CHAR62 '%c'\n", b64chars[62]);
-	printf("#define CHAR63 '%c'\n", b64chars[63]);
-	printf("#define CHARPAD '%c'\n", padchar);
+	printf("/* CHAR62 '%c', CHAR63 '%c', CHARPAD '%c' */\n", b64chars[62], b64chars[63], padchar);
 }
 
 static void clearDecodeTable(uint32_t* ary)
@@ -70,7 +70,7 @@ void uint32_array_to_c_hex(const uint32_t* ary, size_t sz, const char* name)
 {
 	size_t i = 0;
 
-	printf("const uint32_t %s[%d] = {\n", name, (int)sz);
+	printf("const uint32_t %s_%s[%d] = {\n", tablename, name, (int)sz);
 	for (;;) {
 		printf("0x%08" PRIx32, ary[i]);
 		++i;
@@ -91,8 +91,8 @@ int main(int argc, char** argv)
 	uint32_t i = 0;
 	uint32_t ary[256];
 
-	/*  over-ride standard alphabet */
-	if (argc == 2) {
+	/*  over-ride standard alphabet, optionally with a different table name */
+	if (argc == 2 || argc == 3) {
 		uint8_t* replacements = (uint8_t*)argv[1];
 		if (strlen((char*)replacements) != 3) {
 			fprintf(stderr, "input must be a string of 3 characters '-', '.' or '_'\n");
@@ -102,6 +102,9 @@ int main(int argc, char** argv)
 		b64chars[62] = replacements[0];
 		b64chars[63] = replacements[1];
 		padchar = replacements[2];
+		if (argc == 3) {
+			tablename = argv[2];
+		}
 	}
 
 	printStart();
@@ -115,7 +118,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 2;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d0");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d0");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -123,7 +126,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = ((i & 0x30) >> 4) | ((i & 0x0F) << 12);
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d1");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d1");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -131,7 +134,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = ((i & 0x03) << 22) | ((i & 0x3c) << 6);
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d2");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d2");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -139,7 +142,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 16;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d3");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d3");
 	printf("\n\n");
 
 	printf("#else\n");
@@ -151,7 +154,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 26;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d0");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d0");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -159,7 +162,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 20;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d1");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d1");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -167,7 +170,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 14;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d2");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d2");
 	printf("\n\n");
 
 	clearDecodeTable(ary);
@@ -175,7 +178,7 @@ int main(int argc, char** argv)
 		x = b64chars[i];
 		ary[x] = i << 8;
 	}
-	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "base64_table_dec_32bit_d3");
+	uint32_array_to_c_hex(ary, sizeof(ary) / sizeof(uint32_t), "d3");
 	printf("\n\n");
 
 	printf("#endif\n");
@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "tables.h"
 
 const uint8_t
@@ -34,7 +36,424 @@ base64_table_dec_8bit[] =
 	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
 };
 
+const uint8_t
+base64_table_enc_6bit_url[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	"abcdefghijklmnopqrstuvwxyz"
+	"0123456789"
+	"-_";
+
+// The same lookup table for the URL-safe alphabet, in which the characters
+// '-' and '_' take the place of '+' and '/':
+
+const uint8_t
+base64_table_dec_8bit_url[] =
+{
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		//   0..15
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		//  16..31
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255,		//  32..47
+	 52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 254, 255, 255,		//  48..63
+	255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,		//  64..79
+	 15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,  63,		//  80..95
+	255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,		//  96..111
+	 41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255,		// 112..127
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		// 128..143
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
 #if BASE64_WORDSIZE >= 32
 #  include "table_dec_32bit.h"
+#  include "table_dec_32bit_url.h"
 #  include "table_enc_12bit.h"
+#  include "table_enc_12bit_url.h"
+#endif
+
+#include "table_compact.h"
+
+const struct base64_tables
+base64_tables_std =
+{
+	.enc_6bit = base64_table_enc_6bit,
+	.dec_8bit = base64_table_dec_8bit,
+	.pad      = '=',
+
+#if BASE64_WORDSIZE >= 32
+	.enc_12bit    = base64_table_enc_12bit,
+	.dec_32bit_d0 = base64_table_dec_32bit_d0,
+	.dec_32bit_d1 = base64_table_dec_32bit_d1,
+	.dec_32bit_d2 = base64_table_dec_32bit_d2,
+	.dec_32bit_d3 = base64_table_dec_32bit_d3,
+#endif
+
+	.enc_ranges = 1,
+	.dec_ranges = 1,
+
+	.enc_lut = {
+		 65,  71,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4, -19, -16,   0,   0,
+	},
+	.dec_lut_lo = {
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+	},
+	.dec_lut_hi = {
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	.dec_lut_roll = {
+		  0,  19,  16,   4, -65, -65, -71, -71,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	.dec_roll_limit = '/',
+
+	.dec_lut_neon64 = {
+		  0, 255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+		 14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,
+		255, 255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+		 40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255,
+	},
+};
+
+const struct base64_tables
+base64_tables_url =
+{
+	.enc_6bit = base64_table_enc_6bit_url,
+	.dec_8bit = base64_table_dec_8bit_url,
+	.pad      = '=',
+
+#if BASE64_WORDSIZE >= 32
+	.enc_12bit    = base64_table_enc_12bit_url,
+	.dec_32bit_d0 = base64_table_dec_32bit_url_d0,
+	.dec_32bit_d1 = base64_table_dec_32bit_url_d1,
+	.dec_32bit_d2 = base64_table_dec_32bit_url_d2,
+	.dec_32bit_d3 = base64_table_dec_32bit_url_d3,
+#endif
+
+	.enc_ranges = 1,
+	.dec_ranges = 1,
+
+	.enc_lut = {
+		 65,  71,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4,  -4, -17,  32,   0,   0,
+	},
+	.dec_lut_lo = {
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33,
+	},
+	.dec_lut_hi = {
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	.dec_lut_roll = {
+		  0,  17,   4, -65, -65, -32, -71, -71,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	.dec_roll_limit = '_',
+
+	.dec_lut_neon64 = {
+		  0, 255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+		 14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,
+		 63, 255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+		 40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255,
+	},
+};
+
+// The whitespace characters skipped by BASE64_IGNORE_SPACE. A single range
+// covers them all. The control characters in between are no valid input, so
+// including them costs nothing:
+const struct base64_ignore_set
+base64_ignore_space =
+{
+	.nranges = 1,
+	.lo = { '\t' },
+	.hi = { ' ' },
+	.table = {
+		['\t'] = 1, ['\n'] = 1, ['\v'] = 1, ['\f'] = 1, ['\r'] = 1, [' '] = 1,
+	},
+	.skip_lut = {
+		[0] = 0x04, [9] = 0x01, [10] = 0x01, [11] = 0x01, [12] = 0x01, [13] = 0x01,
+	},
+};
+
+// The ASCII whitespace skipped by BASE64_FORGIVING, which is the same without
+// '\v':
+const struct base64_ignore_set
+base64_ignore_forgiving =
+{
+	.nranges = 1,
+	.lo = { '\t' },
+	.hi = { ' ' },
+	.table = {
+		['\t'] = 1, ['\n'] = 1, ['\f'] = 1, ['\r'] = 1, [' '] = 1,
+	},
+	.skip_lut = {
+		[0] = 0x04, [9] = 0x01, [10] = 0x01, [12] = 0x01, [13] = 0x01,
+	},
+};
+
+// Generate the tables for a custom alphabet at runtime. The bytewise and
+// generic tables follow the same recipe as table_generator.c and
+// table_enc_12bit.py. The range-based SIMD constants are derived from the
+// alphabet if it has the right shape, and the table-lookup rows are always
+// generated as a fallback. Returns 0 if the alphabet is invalid:
+int
+base64_tables_generate (struct base64_tables_custom *custom, const uint8_t *chars, uint8_t pad)
+{
+	struct base64_tables *t = &custom->tables;
+	uint16_t valid[16] = { 0 };
+	uint16_t classes[7];
+	int nclasses = 0;
+	int i, j;
+
+	memset(custom, 0, sizeof (*custom));
+
+	// The alphabet must consist of 64 distinct 7-bit characters, and the
+	// padding character must not be one of them:
+	memset(custom->dec_8bit, 255, sizeof (custom->dec_8bit));
+	for (i = 0; i < 64; i++) {
+		if (chars[i] > 127 || custom->dec_8bit[chars[i]] != 255) {
+			return 0;
+		}
+		custom->dec_8bit[chars[i]] = (uint8_t) i;
+		custom->enc_6bit[i] = chars[i];
+	}
+	if (pad != 0) {
+		if (pad > 127 || custom->dec_8bit[pad] != 255) {
+			return 0;
+		}
+		custom->dec_8bit[pad] = 254;
+	}
+
+	t->enc_6bit = custom->enc_6bit;
+	t->dec_8bit = custom->dec_8bit;
+	t->pad      = pad;
+
+#if BASE64_WORDSIZE >= 32
+	t->enc_12bit    = custom->enc_12bit;
+	t->dec_32bit_d0 = custom->dec_32bit[0];
+	t->dec_32bit_d1 = custom->dec_32bit[1];
+	t->dec_32bit_d2 = custom->dec_32bit[2];
+	t->dec_32bit_d3 = custom->dec_32bit[3];
+
+	for (i = 0; i < 4096; i++) {
+#if BASE64_LITTLE_ENDIAN
+		custom->enc_12bit[i] = (uint16_t) (chars[i >> 6] | (chars[i & 0x3F] << 8));
+#else
+		custom->enc_12bit[i] = (uint16_t) ((chars[i >> 6] << 8) | chars[i & 0x3F]);
+#endif
+	}
+
+	memset(custom->dec_32bit, 0xFF, sizeof (custom->dec_32bit));
+	for (i = 0; i < 64; i++) {
+		const uint32_t n = (uint32_t) i;
+#if BASE64_LITTLE_ENDIAN
+		custom->dec_32bit[0][chars[i]] = n << 2;
+		custom->dec_32bit[1][chars[i]] = ((n & 0x30) >> 4) | ((n & 0x0F) << 12);
+		custom->dec_32bit[2][chars[i]] = ((n & 0x03) << 22) | ((n & 0x3C) << 6);
+		custom->dec_32bit[3][chars[i]] = n << 16;
+#else
+		custom->dec_32bit[0][chars[i]] = n << 26;
+		custom->dec_32bit[1][chars[i]] = n << 20;
+		custom->dec_32bit[2][chars[i]] = n << 14;
+		custom->dec_32bit[3][chars[i]] = n << 8;
+#endif
+	}
 #endif
+
+	// The range-based encoders add one offset to all of [0..25], and one
+	// to all of [26..51]. The other twelve values have an offset each:
+	t->enc_ranges = 1;
+	for (i = 1; i < 26; i++) {
+		if (chars[i] != chars[0] + i || chars[26 + i] != chars[26] + i) {
+			t->enc_ranges = 0;
+		}
+	}
+	t->enc_lut[0] = (int8_t) chars[0];
+	t->enc_lut[1] = (int8_t) (chars[26] - 26);
+	for (i = 52; i < 64; i++) {
+		t->enc_lut[i - 50] = (int8_t) (chars[i] - i);
+	}
+
+	// The range-based decoders validate a character by ANDing a bitmask
+	// looked up by its high nibble with one looked up by its low nibble.
+	// Give every distinct set of valid low nibbles its own bit, leaving
+	// out the sign bit, which the SSSE3 decoder does not test:
+	for (i = 0; i < 64; i++) {
+		valid[chars[i] >> 4] |= (uint16_t) (1U << (chars[i] & 0x0F));
+	}
+	t->dec_ranges = (valid[0] == 0);
+	for (i = 0; i < 16 && t->dec_ranges; i++) {
+		for (j = 0; j < nclasses && classes[j] != valid[i]; j++) {
+			continue;
+		}
+		if (j == nclasses) {
+			if (nclasses == 7) {
+				t->dec_ranges = 0;
+				break;
+			}
+			classes[nclasses++] = valid[i];
+		}
+		t->dec_lut_hi[i] = (uint8_t) (1U << j);
+	}
+	for (i = 0; i < 16; i++) {
+		for (j = 0; j < nclasses; j++) {
+			if (!(classes[j] & (1U << i))) {
+				t->dec_lut_lo[i] |= (uint8_t) (1U << j);
+			}
+		}
+	}
+
+	// The offset of a character is looked up by its high nibble, minus one
+	// if the character is below the limit. Find a limit for which all
+	// characters in a slot share the same offset:
+	if (t->dec_ranges) {
+		int limit;
+
+		for (limit = 0; limit < 128; limit++) {
+			uint8_t used[16] = { 0 };
+
+			memset(t->dec_lut_roll, 0, sizeof (t->dec_lut_roll));
+			for (i = 0; i < 64; i++) {
+				const int slot  = (chars[i] >> 4) - (chars[i] < limit);
+				const int8_t roll = (int8_t) (uint8_t) (i - chars[i]);
+
+				if (used[slot] && t->dec_lut_roll[slot] != roll) {
+					break;
+				}
+				used[slot] = 1;
+				t->dec_lut_roll[slot] = roll;
+			}
+			if (i == 64) {
+				break;
+			}
+		}
+		t->dec_roll_limit = (uint8_t) limit;
+		t->dec_ranges = (limit < 128);
+	}
+
+	// The second table of the NEON64 decoder covers characters [64..126]:
+	for (i = 1; i < 64; i++) {
+		t->dec_lut_neon64[i] = custom->dec_8bit[63 + i];
+	}
+
+	// The rows for the table-lookup codecs:
+	for (i = 0; i < 64; i++) {
+		t->enc_lut_xor[i] = chars[i] ^ (i < 16 ? 0 : chars[i - 16]);
+	}
+	for (i = 0; i < 128; i++) {
+		t->dec_lut_xor[i] = custom->dec_8bit[i] ^ (i < 16 ? 0 : custom->dec_8bit[i - 16]);
+	}
+
+	return 1;
+}
+
+// Generate an ignore set from the bytes in the string `bytes` and the
+// NULL-terminated list of strings `seqs`, either of which may be NULL. The
+// candidates are grouped into ranges of consecutive bytes, and the ranges are
+// merged where that is cheap. The bytes in between become candidates that are
+// kept after all, which costs speed but not correctness. Returns 0 if there are too many sequences, or if a sequence is
+// empty or too long:
+int
+base64_ignore_generate (struct base64_ignore_set *set, const char *bytes, const char *const *seqs)
+{
+	uint8_t lo[64], hi[64];
+	int nruns = 0;
+	int i, j;
+
+	memset(set, 0, sizeof (*set));
+
+	for (; bytes != NULL && *bytes != '\0'; bytes++) {
+		set->table[(uint8_t) *bytes] |= BASE64_IGNORE_BYTE;
+	}
+
+	// Keep the sequences in order of increasing length, so that the
+	// decoder can stop at the first match. A sequence of one byte is just
+	// another byte in the set:
+	for (i = 0; seqs != NULL && seqs[i] != NULL; i++) {
+		const size_t len = strlen(seqs[i]);
+
+		if (len == 0 || len > BASE64_IGNORE_SEQLEN) {
+			return 0;
+		}
+		if (len == 1) {
+			set->table[(uint8_t) seqs[i][0]] |= BASE64_IGNORE_BYTE;
+			continue;
+		}
+		if (set->nseqs == BASE64_IGNORE_SEQS) {
+			return 0;
+		}
+		for (j = set->nseqs; j > 0 && set->seqlen[j - 1] > len; j--) {
+			memcpy(set->seq[j], set->seq[j - 1], BASE64_IGNORE_SEQLEN);
+			set->seqlen[j] = set->seqlen[j - 1];
+		}
+		memset(set->seq[j], 0, BASE64_IGNORE_SEQLEN);
+		memcpy(set->seq[j], seqs[i], len);
+		set->seqlen[j] = (uint8_t) len;
+		set->nseqs++;
+		set->table[(uint8_t) seqs[i][0]] |= BASE64_IGNORE_SEQ;
+	}
+
+	// Collect the candidates below 128 in runs of consecutive bytes:
+	for (i = 1; i < 128; i++) {
+		if (set->table[i] == 0) {
+			continue;
+		}
+		if (nruns > 0 && hi[nruns - 1] == i - 1) {
+			hi[nruns - 1] = (uint8_t) i;
+		}
+		else {
+			lo[nruns] = hi[nruns] = (uint8_t) i;
+			nruns++;
+		}
+	}
+
+	// Merge runs across gaps that hold no characters of the standard and
+	// URL-safe alphabets, which costs nothing, and then across the gaps
+	// that hold the fewest of them until the runs fit:
+	while (nruns > 1) {
+		int best = 0, best_cost = 256;
+
+		for (i = 0; i < nruns - 1; i++) {
+			int cost = 0;
+
+			for (j = hi[i] + 1; j < lo[i + 1]; j++) {
+				cost += (base64_table_dec_8bit[j] != 255 || base64_table_dec_8bit_url[j] != 255);
+			}
+			if (cost < best_cost) {
+				best = i;
+				best_cost = cost;
+			}
+		}
+		if (best_cost > 0 && nruns <= BASE64_IGNORE_RANGES) {
+			break;
+		}
+		hi[best] = hi[best + 1];
+		for (i = best + 1; i < nruns - 1; i++) {
+			lo[i] = lo[i + 1];
+			hi[i] = hi[i + 1];
+		}
+		nruns--;
+	}
+	for (i = 0; i < nruns; i++) {
+		set->lo[i] = lo[i];
+		set->hi[i] = hi[i];
+	}
+	set->nranges = nruns;
+
+	for (i = 128; i < 256; i++) {
+		if (set->table[i] != 0) {
+			set->high = 1;
+		}
+	}
+	for (i = 1; i < 128; i++) {
+		if (set->table[i] & BASE64_IGNORE_BYTE) {
+			set->skip_lut[i & 15] |= (uint8_t) (1 << (i >> 4));
+		}
+		if (set->table[i] & BASE64_IGNORE_SEQ) {
+			set->seq_lut[i & 15] |= (uint8_t) (1 << (i >> 4));
+		}
+	}
+	return 1;
+}
@@ -1,13 +1,17 @@
 #ifndef BASE64_TABLES_H
 #define BASE64_TABLES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "../../include/libbase64.h"
 #include "../env.h"
 
 // These tables are used by all codecs for fallback plain encoding/decoding:
 extern const uint8_t base64_table_enc_6bit[];
 extern const uint8_t base64_table_dec_8bit[];
+extern const uint8_t base64_table_enc_6bit_url[];
+extern const uint8_t base64_table_dec_8bit_url[];
 
 // These tables are used for the 32-bit and 64-bit generic decoders:
 #if BASE64_WORDSIZE >= 32
@@ -15,9 +19,164 @@ extern const uint32_t base64_table_dec_32bit_d0[];
 extern const uint32_t base64_table_dec_32bit_d1[];
 extern const uint32_t base64_table_dec_32bit_d2[];
 extern const uint32_t base64_table_dec_32bit_d3[];
+extern const uint32_t base64_table_dec_32bit_url_d0[];
+extern const uint32_t base64_table_dec_32bit_url_d1[];
+extern const uint32_t base64_table_dec_32bit_url_d2[];
+extern const uint32_t base64_table_dec_32bit_url_d3[];
 
 // This table is used by the 32 and 64-bit generic encoders:
 extern const uint16_t base64_table_enc_12bit[];
+extern const uint16_t base64_table_enc_12bit_url[];
 #endif
 
+// These tables are used by the SIMD loops that skip the bytes of an ignore
+// set. For each 8-bit mask of lanes to keep, they list the kept lanes in order
+// and count them:
+extern const uint8_t base64_table_compact[256][8];
+extern const uint8_t base64_table_compact_len[256];
+
+// All tables and SIMD constants that depend on the alphabet. The codecs
+// select one of these sets at the start of every call:
+struct base64_tables {
+
+	// Bytewise tables:
+	const uint8_t *enc_6bit;
+	const uint8_t *dec_8bit;
+
+	// The padding character, or zero if the alphabet has none:
+	uint8_t pad;
+
+#if BASE64_WORDSIZE >= 32
+	// Tables for the 32-bit and 64-bit generic codecs:
+	const uint16_t *enc_12bit;
+	const uint32_t *dec_32bit_d0;
+	const uint32_t *dec_32bit_d1;
+	const uint32_t *dec_32bit_d2;
+	const uint32_t *dec_32bit_d3;
+#endif
+
+	// Nonzero if the alphabet fits the range-based SIMD encoders and
+	// decoders below. If not, the x86 codecs fall back on table lookups:
+	int enc_ranges;
+	int dec_ranges;
+
+	// Offsets for the range-based encoders (SSSE3, AVX, AVX2 and NEON32),
+	// see the SSSE3 enc_translate() for an explanation:
+	int8_t enc_lut[16];
+
+	// Nibble lookup tables for the range-based decoders (SSSE3, AVX2 and
+	// NEON32), see the SSSE3 decoder for an explanation. Input bytes below
+	// `dec_roll_limit` take their offset from one slot below the slot of
+	// their high nibble:
+	uint8_t dec_lut_lo[16];
+	uint8_t dec_lut_hi[16];
+	int8_t  dec_lut_roll[16];
+	uint8_t dec_roll_limit;
+
+	// Second lookup table of the NEON64 decoder, which maps input bytes
+	// [64..126] to index [1..63]:
+	uint8_t dec_lut_neon64[64];
+
+	// Lookup tables for the x86 table-lookup codecs, used when the
+	// alphabet does not fit the range-based codecs. Each 16-byte row is
+	// the XOR of two consecutive rows of the encoding table (4 rows) or of
+	// the first half of the decoding table (8 rows):
+	uint8_t enc_lut_xor[64];
+	uint8_t dec_lut_xor[128];
+};
+
+// The storage behind a custom alphabet. This is what the opaque bytes of
+// struct base64_alphabet hold after base64_alphabet_init():
+struct base64_tables_custom {
+	struct base64_tables tables;
+	uint8_t enc_6bit[64];
+	uint8_t dec_8bit[256];
+#if BASE64_WORDSIZE >= 32
+	uint16_t enc_12bit[4096];
+	uint32_t dec_32bit[4][256];
+#endif
+};
+
+// A set of bytes and byte sequences that the decoder skips. The bytes in the
+// set and the first bytes of the sequences are the candidates, which the
+// decoder finds by scanning the input a block at a time. The candidates below
+// 128 lie within the ranges [lo..hi], where 0 < lo <= hi < 128. If there are
+// candidates above 127, all bytes above 127 are scanned for. The table then
+// tells what to do with each candidate:
+#define BASE64_IGNORE_RANGES	4
+#define BASE64_IGNORE_SEQS	8
+#define BASE64_IGNORE_SEQLEN	4
+
+#define BASE64_IGNORE_BYTE	1	// Skip this byte
+#define BASE64_IGNORE_SEQ	2	// Skip the sequence starting here, if any
+
+struct base64_ignore_set {
+	int nranges;
+	int high;
+	uint8_t lo[BASE64_IGNORE_RANGES];
+	uint8_t hi[BASE64_IGNORE_RANGES];
+	uint8_t table[256];
+
+	// The bytes below 128 to skip, and the first bytes below 128 of the
+	// sequences, as bitmaps for the SIMD loops. Bit `c >> 4` of entry
+	// `c & 15` is set for each of them:
+	uint8_t skip_lut[16];
+	uint8_t seq_lut[16];
+
+	// The sequences, in order of increasing length:
+	int nseqs;
+	uint8_t seqlen[BASE64_IGNORE_SEQS];
+	uint8_t seq[BASE64_IGNORE_SEQS][BASE64_IGNORE_SEQLEN];
+};
+
+extern const struct base64_tables base64_tables_std;
+extern const struct base64_tables base64_tables_url;
+extern const struct base64_ignore_set base64_ignore_space;
+extern const struct base64_ignore_set base64_ignore_forgiving;
+
+int base64_tables_generate (struct base64_tables_custom *custom, const uint8_t *chars, uint8_t pad);
+int base64_ignore_generate (struct base64_ignore_set *set, const char *bytes, const char *const *seqs);
+
+// Check whether one of the sequences of the set starts at `src`. Returns its
+// length, zero if none matches, or -1 if the input ends in the middle of one.
+// The bytes are compared in a loop rather than with memcmp(), since a call
+// from the SIMD loops makes the compiler spill their vector registers:
+static inline int
+base64_ignore_match (const struct base64_ignore_set *set, const uint8_t *src, size_t srclen)
+{
+	int i, partial = 0;
+
+	for (i = 0; i < set->nseqs; i++) {
+		const size_t len = set->seqlen[i];
+		const size_t n = (len <= srclen) ? len : srclen;
+		size_t j = 0;
+
+		while (j < n && src[j] == set->seq[i][j]) {
+			j++;
+		}
+		if (j == n) {
+			if (len <= srclen) {
+				return (int) len;
+			}
+			partial = 1;
+		}
+	}
+	return partial ? -1 : 0;
+}
+
+static inline const struct base64_tables *
+base64_tables_for (int flags, const struct base64_alphabet *alphabet)
+{
+	if (alphabet != NULL) {
+		return &((const struct base64_tables_custom *) alphabet)->tables;
+	}
+	return (flags & BASE64_URLSAFE) ? &base64_tables_url : &base64_tables_std;
+}
+
+static inline const struct base64_tables *
+base64_tables_choose (const struct base64_state *state)
+{
+	return base64_tables_for(state->flags, state->alphabet);
+}
+
 #endif	// BASE64_TABLES_H
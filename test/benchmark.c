@@ -51,6 +51,20 @@ sizes[] = {
 	{ "1 KB",	KB * 1,		100,	1000	},
 };
 
+// Define tiny input sizes, such as tokens and keys, to measure the fixed
+// overhead of a call with:
+static const size_t tiny_sizes[] = { 16, 24, 32, 48, 64 };
+
+#define TINY_REPEAT	10
+#define TINY_BATCH	100000
+
+// Define the chunk sizes of the stream benchmark, which are not multiples of
+// three or four, so that most calls end in a partial block, and the entry in
+// sizes[] of the buffer that is streamed in those chunks:
+static const size_t chunk_sizes[] = { 100, 257, 1001 };
+
+#define STREAM_SIZE	2
+
 static inline float
 bytes_to_mb (size_t bytes)
 {
@@ -181,6 +195,92 @@ codec_bench (struct buffers *b, const struct bufsize *bs, const char *name, unsi
 	codec_bench_dec(b, bs, name, flags);
 }
 
+// Encode and decode the buffer as a stream in chunks of `chunk` bytes, to
+// compare with the one-shot functions on the same buffer:
+static void
+codec_bench_stream (struct buffers *b, const struct bufsize *bs, size_t chunk, const char *name, unsigned int flags)
+{
+	float timediff, fastest_enc = -1.0f, fastest_dec = -1.0f;
+	base64_timespec start, end;
+	struct base64_state state;
+	size_t enclen = 0, outlen, i;
+
+	for (int r = bs->repeat; r; r--) {
+
+		// Encode the whole buffer in chunks:
+		base64_gettime(&start);
+		for (int j = bs->batch; j; j--) {
+			base64_stream_encode_init(&state, flags);
+			for (i = enclen = 0; i < bs->len; i += chunk) {
+				base64_stream_encode(&state, b->reg + i, (bs->len - i < chunk) ? bs->len - i : chunk, b->enc + enclen, &outlen);
+				enclen += outlen;
+			}
+			base64_stream_encode_final(&state, b->enc + enclen, &outlen);
+			enclen += outlen;
+		}
+		base64_gettime(&end);
+
+		timediff = timediff_sec(&start, &end) / bs->batch;
+		if (fastest_enc < 0.0f || timediff < fastest_enc)
+			fastest_enc = timediff;
+
+		// Decode it back in chunks of the same size:
+		base64_gettime(&start);
+		for (int j = bs->batch; j; j--) {
+			base64_stream_decode_init(&state, flags);
+			for (i = b->regsz = 0; i < enclen; i += chunk) {
+				base64_stream_decode(&state, b->enc + i, (enclen - i < chunk) ? enclen - i : chunk, b->reg + b->regsz, &outlen);
+				b->regsz += outlen;
+			}
+		}
+		base64_gettime(&end);
+
+		timediff = timediff_sec(&start, &end) / bs->batch;
+		if (fastest_dec < 0.0f || timediff < fastest_dec)
+			fastest_dec = timediff;
+	}
+
+	printf("%s\tencode\t%zu-byte chunks\t%.02f MB/sec\n", name, chunk, bytes_to_mb(bs->len) / fastest_enc);
+	printf("%s\tdecode\t%zu-byte chunks\t%.02f MB/sec\n", name, chunk, bytes_to_mb(enclen) / fastest_dec);
+}
+
+static void
+codec_bench_tiny (struct buffers *b, size_t len, const char *name, unsigned int flags)
+{
+	float timediff, fastest_enc = -1.0f, fastest_dec = -1.0f;
+	base64_timespec start, end;
+	size_t enclen;
+
+	// Encode once, to have valid input for the decoder:
+	base64_encode(b->reg, len, b->enc, &enclen, flags);
+
+	for (int i = TINY_REPEAT; i; i--) {
+
+		// Encode the same short string over and over:
+		base64_gettime(&start);
+		for (int j = TINY_BATCH; j; j--)
+			base64_encode(b->reg, len, b->enc, &b->encsz, flags);
+		base64_gettime(&end);
+
+		timediff = timediff_sec(&start, &end) / TINY_BATCH;
+		if (fastest_enc < 0.0f || timediff < fastest_enc)
+			fastest_enc = timediff;
+
+		// Decode it back, into a separate part of the buffer:
+		base64_gettime(&start);
+		for (int j = TINY_BATCH; j; j--)
+			base64_decode(b->enc, enclen, b->reg + len, &b->regsz, flags);
+		base64_gettime(&end);
+
+		timediff = timediff_sec(&start, &end) / TINY_BATCH;
+		if (fastest_dec < 0.0f || timediff < fastest_dec)
+			fastest_dec = timediff;
+	}
+
+	printf("%s\tencode\t%.01f ns/call\n", name, fastest_enc * 1e9f);
+	printf("%s\tdecode\t%.01f ns/call\n", name, fastest_dec * 1e9f);
+}
+
 int
 main ()
 {
@@ -223,6 +323,34 @@ main ()
 				codec_bench(&b, &sizes[i], codecs[j], 1 << j);
 	};
 
+	// Compare streaming in odd-sized chunks with the one-shot functions on
+	// the same buffer:
+	printf("Testing stream chunks over buffer size %s, fastest of %d * %d\n",
+		sizes[STREAM_SIZE].label, sizes[STREAM_SIZE].repeat, sizes[STREAM_SIZE].batch);
+
+	for (size_t j = 0; codecs[j]; j++) {
+		if (!codec_supported(1 << j))
+			continue;
+
+		codec_bench(&b, &sizes[STREAM_SIZE], codecs[j], 1 << j);
+
+		for (size_t i = 0; i < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); i++)
+			codec_bench_stream(&b, &sizes[STREAM_SIZE], chunk_sizes[i], codecs[j], 1 << j);
+	}
+
+	// Loop over the tiny buffer sizes, where the cost of a call is mostly
+	// fixed overhead. The default codec is chosen without any flags:
+	for (size_t i = 0; i < sizeof(tiny_sizes) / sizeof(tiny_sizes[0]); i++) {
+		printf("Testing with buffer size %zu bytes, fastest of %d * %d\n",
+			tiny_sizes[i], TINY_REPEAT, TINY_BATCH);
+
+		codec_bench_tiny(&b, tiny_sizes[i], "default", 0);
+
+		for (size_t j = 0; codecs[j]; j++)
+			if (codec_supported(1 << j))
+				codec_bench_tiny(&b, tiny_sizes[i], codecs[j], 1 << j);
+	}
+
 	// Free memory:
 err2:	free(b.enc);
 err1:	free(b.reg);
@@ -2,6 +2,11 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef _WIN32
+struct iovec { void *iov_base; size_t iov_len; };
+#else
+#include <sys/uio.h>
+#endif
 #include "../include/libbase64.h"
 #include "codec_supported.h"
 #include "moby_dick.h"
@@ -163,8 +168,8 @@ test_streaming (int flags)
 	for (int i = 0; i < 256; i++)
 		chr[i] = (unsigned char)i;
 
-	// Create reference base64 encoding:
-	base64_encode(chr, 256, ref, &reflen, BASE64_FORCE_PLAIN);
+	// Create reference base64 encoding in the same alphabet:
+	base64_encode(chr, 256, ref, &reflen, BASE64_FORCE_PLAIN | (flags & BASE64_URLSAFE));
 
 	// Encode the table with various block sizes and compare to reference:
 	for (size_t bs = 1; bs < 255; bs++)
@@ -312,6 +317,1428 @@ test_invalid_dec_input (int flags)
 	return fail;
 }
 
+static int
+test_urlsafe (int flags)
+{
+	bool fail = false;
+	char chr[256];
+	char std[400], url[400], dec[400];
+	size_t stdlen, urllen, declen;
+
+	// Fill array with all characters 0..255:
+	for (int i = 0; i < 256; i++)
+		chr[i] = (unsigned char)i;
+
+	// Encode the table in both alphabets:
+	base64_encode(chr, 256, std, &stdlen, flags);
+	base64_encode(chr, 256, url, &urllen, flags | BASE64_URLSAFE);
+
+	// The outputs should only differ in the last two characters of the
+	// alphabet:
+	if (urllen != stdlen) {
+		printf("FAIL: URL-safe encoding gave incorrect size: "
+			"%lu instead of %lu\n",
+			(unsigned long)urllen,
+			(unsigned long)stdlen
+		);
+		return true;
+	}
+	for (size_t i = 0; i < stdlen; i++) {
+		char c = (std[i] == '+') ? '-' : (std[i] == '/') ? '_' : std[i];
+
+		if (url[i] != c) {
+			printf("FAIL: URL-safe encoding @ %lu: expected '%c', got '%c'\n",
+				(unsigned long)i, c, url[i]
+			);
+			fail = true;
+			break;
+		}
+	}
+
+	// Both alphabets should reject the characters of the other one:
+	if (base64_decode(std, stdlen, dec, &declen, flags | BASE64_URLSAFE)) {
+		printf("FAIL: URL-safe decoding of standard alphabet: no decoding error\n");
+		fail = true;
+	}
+	if (base64_decode(url, urllen, dec, &declen, flags)) {
+		printf("FAIL: standard decoding of URL-safe alphabet: no decoding error\n");
+		fail = true;
+	}
+
+	// Test vectors that contain the last two characters of the alphabet:
+	fail |= assert_enc(flags | BASE64_URLSAFE, "\xfb\xff\xbf", "-_-_");
+	fail |= assert_dec(flags | BASE64_URLSAFE, "-_-_", "\xfb\xff\xbf");
+	fail |= assert_enc(flags | BASE64_URLSAFE, "\xff\xfe", "__4=");
+	fail |= assert_dec(flags | BASE64_URLSAFE, "__4=", "\xff\xfe");
+
+	// Test vectors without padding:
+	fail |= assert_enc(flags | BASE64_NOPAD, "f", "Zg");
+	fail |= assert_enc(flags | BASE64_NOPAD, "fo", "Zm8");
+	fail |= assert_enc(flags | BASE64_NOPAD, "foo", "Zm9v");
+	fail |= assert_dec(flags | BASE64_NOPAD, "Zg", "f");
+	fail |= assert_dec(flags | BASE64_NOPAD, "Zm8", "fo");
+	fail |= assert_dec(flags | BASE64_NOPAD, "Zm8=", "fo");
+	fail |= assert_enc(flags | BASE64_URLSAFE | BASE64_NOPAD, "\xff\xfe", "__4");
+	fail |= assert_dec(flags | BASE64_URLSAFE | BASE64_NOPAD, "__4", "\xff\xfe");
+
+	// A single trailing character or a partial padding is still invalid:
+	if (base64_decode("Zm9vY", 5, dec, &declen, flags | BASE64_NOPAD)) {
+		printf("FAIL: decoding invalid input \"Zm9vY\" without padding: no decoding error\n");
+		fail = true;
+	}
+	if (base64_decode("Zm9vYg=", 7, dec, &declen, flags | BASE64_NOPAD)) {
+		printf("FAIL: decoding invalid input \"Zm9vYg=\" without padding: no decoding error\n");
+		fail = true;
+	}
+
+	// Roundtrips and streaming in the URL-safe alphabet:
+	fail |= test_char_table(flags | BASE64_URLSAFE, false);
+	fail |= test_char_table(flags | BASE64_URLSAFE | BASE64_NOPAD, true);
+	fail |= test_streaming(flags | BASE64_URLSAFE);
+
+	return fail;
+}
+
+// Encode `src` as a stream in blocks of `bs` bytes, wrapped at `cols`:
+static size_t
+encode_wrapped (int flags, const char *src, size_t srclen, char *out, size_t bs, size_t cols, int crlf)
+{
+	struct base64_state state;
+	size_t outlen, total = 0;
+
+	base64_stream_encode_init(&state, flags);
+	base64_stream_set_wrap(&state, cols, crlf);
+
+	for (size_t i = 0; i < srclen; i += bs) {
+		size_t len = (i + bs > srclen) ? srclen - i : bs;
+
+		base64_stream_encode(&state, &src[i], len, &out[total], &outlen);
+		total += outlen;
+	}
+	base64_stream_encode_final(&state, &out[total], &outlen);
+
+	return total + outlen;
+}
+
+// Allocate `len` bytes that are not periodic with the chunks or blocks of the
+// codecs; returns NULL when out of memory:
+static char *
+test_bytes (size_t len, unsigned shift)
+{
+	char *src = malloc(len);
+
+	if (src == NULL) {
+		return NULL;
+	}
+	for (size_t i = 0; i < len; i++) {
+		src[i] = (char) (i * 2654435761u >> shift);
+	}
+	return src;
+}
+
+static int
+test_wrap (int flags)
+{
+	static const struct {
+		size_t cols;
+		int crlf;
+	} wraps[] = {
+		{ 76, 1 },	// MIME
+		{ 64, 0 },	// PEM
+		{  1, 0 },
+		{ 77, 1 },
+		{ 16, 1 },	// The narrowest lines of the SIMD loops
+		{ 17, 0 },
+		{ 40, 0 },
+	};
+
+	bool fail = false;
+	char ref[4000], enc[4000];
+	size_t enclen = strlen(moby_dick_base64);
+	size_t plainlen = strlen(moby_dick_plain);
+
+	for (size_t w = 0; w < sizeof (wraps) / sizeof (wraps[0]); w++) {
+		const size_t cols = wraps[w].cols;
+		const int crlf = wraps[w].crlf;
+		size_t reflen = 0;
+
+		// Wrap the reference encoding by hand, with a line break
+		// after every line including the last:
+		for (size_t i = 0; i < enclen; i++) {
+			ref[reflen++] = moby_dick_base64[i];
+			if ((i + 1) % cols == 0 || i + 1 == enclen) {
+				if (crlf) {
+					ref[reflen++] = '\r';
+				}
+				ref[reflen++] = '\n';
+			}
+		}
+
+		// Encode as a stream with various block sizes:
+		for (size_t bs = 1; bs < 100; bs += 7) {
+			size_t len = encode_wrapped(flags, moby_dick_plain, plainlen, enc, bs, cols, crlf);
+
+			if (len != reflen || memcmp(enc, ref, reflen) != 0) {
+				printf("FAIL: wrapping at %lu with blocksize %lu failed\n",
+					(unsigned long)cols, (unsigned long)bs);
+				fail = true;
+			}
+		}
+
+		// And in one go, so that the SIMD loops break most of the lines:
+		if (encode_wrapped(flags, moby_dick_plain, plainlen, enc, plainlen, cols, crlf) != reflen || memcmp(enc, ref, reflen) != 0) {
+			printf("FAIL: wrapping at %lu in one go failed\n", (unsigned long)cols);
+			fail = true;
+		}
+	}
+
+	// A line that ends with the output ends with a single line break, and
+	// empty output stays empty:
+	if (encode_wrapped(flags, "foobar", 6, enc, 6, 8, 0) != 9 || memcmp(enc, "Zm9vYmFy\n", 9) != 0) {
+		printf("FAIL: wrapping of a single full line failed\n");
+		fail = true;
+	}
+	if (encode_wrapped(flags, "foob", 4, enc, 4, 4, 1) != 12 || memcmp(enc, "Zm9v\r\nYg==\r\n", 12) != 0) {
+		printf("FAIL: wrapping of the padding failed\n");
+		fail = true;
+	}
+	if (encode_wrapped(flags, "", 0, enc, 1, 76, 0) != 0) {
+		printf("FAIL: wrapping of empty input failed\n");
+		fail = true;
+	}
+
+	return fail;
+}
+
+static int
+test_ignore_space (int flags)
+{
+	bool fail = false;
+	char wrapped[3000], dec[2000];
+	size_t wrappedlen = 0, declen;
+	size_t enclen = strlen(moby_dick_base64);
+	size_t plainlen = strlen(moby_dick_plain);
+	struct base64_state state;
+
+	// Wrap the encoded text in lines of 76 characters with CRLF line
+	// endings, and add some more whitespace in the middle of a line:
+	for (size_t i = 0; i < enclen; i++) {
+		if (i > 0 && i % 76 == 0) {
+			wrapped[wrappedlen++] = '\r';
+			wrapped[wrappedlen++] = '\n';
+		}
+		if (i == 300) {
+			wrapped[wrappedlen++] = ' ';
+			wrapped[wrappedlen++] = '\t';
+		}
+		wrapped[wrappedlen++] = moby_dick_base64[i];
+	}
+	wrapped[wrappedlen++] = '\n';
+
+	// Decode as a whole:
+	if (!base64_decode(wrapped, wrappedlen, dec, &declen, flags | BASE64_IGNORE_SPACE)) {
+		printf("FAIL: decoding of wrapped input: decoding error\n");
+		fail = true;
+	}
+	else if (declen != plainlen || memcmp(dec, moby_dick_plain, plainlen) != 0) {
+		printf("FAIL: decoding of wrapped input: wrong output\n");
+		fail = true;
+	}
+
+	// Decode as a stream with various block sizes:
+	for (size_t bs = 1; bs < 100; bs += 7) {
+		size_t partlen, total = 0;
+		int ret = 1;
+
+		base64_stream_decode_init(&state, flags | BASE64_IGNORE_SPACE);
+		for (size_t i = 0; i < wrappedlen && ret; i += bs) {
+			size_t len = (i + bs > wrappedlen) ? wrappedlen - i : bs;
+
+			ret = base64_stream_decode(&state, &wrapped[i], len, &dec[total], &partlen);
+			total += partlen;
+		}
+		if (!ret || total != plainlen || memcmp(dec, moby_dick_plain, plainlen) != 0) {
+			printf("FAIL: stream decoding of wrapped input with blocksize %lu failed\n",
+				(unsigned long)bs);
+			fail = true;
+		}
+	}
+
+	// Without the flag, whitespace is invalid:
+	if (base64_decode(wrapped, wrappedlen, dec, &declen, flags)) {
+		printf("FAIL: decoding of wrapped input without BASE64_IGNORE_SPACE: no decoding error\n");
+		fail = true;
+	}
+
+	// Other invalid characters are still rejected:
+	wrapped[500] = '*';
+	if (base64_decode(wrapped, wrappedlen, dec, &declen, flags | BASE64_IGNORE_SPACE)) {
+		printf("FAIL: decoding of wrapped input with invalid character: no decoding error\n");
+		fail = true;
+	}
+
+	// Whitespace around and between the padding characters:
+	fail |= assert_dec(flags | BASE64_IGNORE_SPACE, " Zm9v\r\nYg=\r\n=\r\n", "foob");
+	fail |= assert_dec(flags | BASE64_IGNORE_SPACE, "Zm9vYmE=\n", "fooba");
+	fail |= assert_dec(flags | BASE64_IGNORE_SPACE, "\n\n", "");
+
+	return fail;
+}
+
+static int
+test_ignore_set (int flags)
+{
+	static const char *const escapes[] = { "\\n", "\\r", NULL };
+	static const char *const newline[] = { "\\n", NULL };
+	static const char *const too_long[] = { "\\u000a", NULL };
+	static const char *const empty[] = { "", NULL };
+	static const char *const too_many[] = { "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", NULL };
+
+	bool fail = false;
+	char wrapped[3000], dec[2000];
+	size_t wrappedlen = 0, declen;
+	size_t enclen = strlen(moby_dick_base64);
+	size_t plainlen = strlen(moby_dick_plain);
+	struct base64_ignore ignore;
+	struct base64_state state;
+
+	// Wrap the encoded text in lines of 64 characters, separated by the
+	// escaped line breaks of a PEM file embedded in a JSON string. Add a
+	// tab and a vendor-specific separator in the middle of a line:
+	for (size_t i = 0; i < enclen; i++) {
+		if (i > 0 && i % 64 == 0) {
+			memcpy(&wrapped[wrappedlen], "\\r\\n", 4);
+			wrappedlen += 4;
+		}
+		if (i == 300) {
+			wrapped[wrappedlen++] = '\t';
+			wrapped[wrappedlen++] = '|';
+		}
+		wrapped[wrappedlen++] = moby_dick_base64[i];
+	}
+	memcpy(&wrapped[wrappedlen], "\\n", 2);
+	wrappedlen += 2;
+
+	if (!base64_ignore_init(&ignore, "\t|", escapes)) {
+		printf("FAIL: initializing ignore set failed\n");
+		return true;
+	}
+
+	// Decode as a stream with various block sizes, so that the escape
+	// sequences straddle the blocks:
+	for (size_t bs = 1; bs < 100; bs += 7) {
+		size_t partlen, total = 0;
+		int ret = 1;
+
+		base64_stream_decode_init(&state, flags);
+		base64_stream_set_ignore(&state, &ignore);
+		for (size_t i = 0; i < wrappedlen && ret; i += bs) {
+			size_t len = (i + bs > wrappedlen) ? wrappedlen - i : bs;
+
+			ret = base64_stream_decode(&state, &wrapped[i], len, &dec[total], &partlen);
+			total += partlen;
+		}
+		if (!ret || state.ignore_bytes != 0 || total != plainlen || memcmp(dec, moby_dick_plain, plainlen) != 0) {
+			printf("FAIL: stream decoding with ignore set with blocksize %lu failed\n",
+				(unsigned long)bs);
+			fail = true;
+		}
+	}
+
+	// Decode in one go, so that the SIMD loops match the sequences:
+	base64_stream_decode_init(&state, flags);
+	base64_stream_set_ignore(&state, &ignore);
+	if (!base64_stream_decode(&state, wrapped, wrappedlen, dec, &declen) || declen != plainlen || memcmp(dec, moby_dick_plain, plainlen) != 0) {
+		printf("FAIL: decoding with ignore set in one go failed\n");
+		fail = true;
+	}
+
+	// A line break that is a byte of the set may be followed by the rest of
+	// a sequence on a later line, which is then skipped with it:
+	if (!base64_ignore_init(&ignore, "\\", newline)) {
+		printf("FAIL: initializing ignore set failed\n");
+		return true;
+	}
+	wrappedlen = 0;
+	for (size_t i = 0; i < 5 * 64; i++) {
+		if (i > 0 && i % 64 == 0) {
+			wrapped[wrappedlen++] = '\\';
+		}
+		if (i == 4 * 64) {
+			wrapped[wrappedlen++] = 'n';
+		}
+		wrapped[wrappedlen++] = moby_dick_base64[i];
+	}
+	base64_stream_decode_init(&state, flags);
+	base64_stream_set_ignore(&state, &ignore);
+	if (!base64_stream_decode(&state, wrapped, wrappedlen, dec, &declen) || declen != 5 * 48 || memcmp(dec, moby_dick_plain, 5 * 48) != 0) {
+		printf("FAIL: decoding with ignore set: sequence after repeated line break not skipped\n");
+		fail = true;
+	}
+	if (!base64_ignore_init(&ignore, "\t|", escapes)) {
+		printf("FAIL: initializing ignore set failed\n");
+		return true;
+	}
+
+	// Input that ends in the middle of an escape sequence is held back:
+	base64_stream_decode_init(&state, flags);
+	base64_stream_set_ignore(&state, &ignore);
+	if (!base64_stream_decode(&state, "Zm9v\\", 5, dec, &declen) || declen != 3 || state.ignore_bytes != 1) {
+		printf("FAIL: decoding with ignore set: trailing partial escape not held back\n");
+		fail = true;
+	}
+
+	// An escape sequence that is not in the set is invalid:
+	base64_stream_decode_init(&state, flags);
+	base64_stream_set_ignore(&state, &ignore);
+	if (base64_stream_decode(&state, "Zm9v\\tYmFy", 10, dec, &declen)) {
+		printf("FAIL: decoding with ignore set: unknown escape accepted\n");
+		fail = true;
+	}
+
+	// Invalid sets:
+	if (base64_ignore_init(&ignore, NULL, too_long)) {
+		printf("FAIL: ignore set with too long sequence accepted\n");
+		fail = true;
+	}
+	if (base64_ignore_init(&ignore, NULL, empty)) {
+		printf("FAIL: ignore set with empty sequence accepted\n");
+		fail = true;
+	}
+	if (base64_ignore_init(&ignore, NULL, too_many)) {
+		printf("FAIL: ignore set with too many sequences accepted\n");
+		fail = true;
+	}
+
+	return fail;
+}
+
+static int
+test_alphabet_one (int flags, const char *name, const char *chars, char pad)
+{
+	static const char std_chars[] =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	bool fail = false;
+	struct base64_alphabet alphabet;
+	char src[768], std[1100], ref[1100], enc[1100], dec[800];
+	size_t stdlen, reflen, enclen, declen;
+
+	if (!base64_alphabet_init(&alphabet, chars, pad)) {
+		printf("FAIL: %s alphabet: initialization failed\n", name);
+		return true;
+	}
+
+	for (size_t i = 0; i < sizeof(src); i++)
+		src[i] = (char)(i * 7 + (i >> 8));
+
+	// Test all three input lengths modulo 3, long enough for all codecs:
+	for (size_t srclen = 766; srclen <= 768; srclen++) {
+
+		// Encode in the standard alphabet and translate the output to
+		// get the reference:
+		base64_encode(src, srclen, std, &stdlen, flags);
+		reflen = 0;
+		for (size_t i = 0; i < stdlen; i++) {
+			if (std[i] != '=')
+				ref[reflen++] = chars[strchr(std_chars, std[i]) - std_chars];
+			else if (pad)
+				ref[reflen++] = pad;
+		}
+
+		base64_encode_alphabet(src, srclen, enc, &enclen, flags, &alphabet);
+		if (enclen != reflen || memcmp(enc, ref, reflen) != 0) {
+			printf("FAIL: %s alphabet: encoding of %lu bytes differs from reference\n",
+				name, (unsigned long)srclen);
+			fail = true;
+			continue;
+		}
+
+		if (!base64_decode_alphabet(enc, enclen, dec, &declen, flags, &alphabet)) {
+			printf("FAIL: %s alphabet: decoding of %lu bytes: decoding error\n",
+				name, (unsigned long)srclen);
+			fail = true;
+			continue;
+		}
+		if (declen != srclen || memcmp(dec, src, srclen) != 0) {
+			printf("FAIL: %s alphabet: roundtrip of %lu bytes failed\n",
+				name, (unsigned long)srclen);
+			fail = true;
+		}
+	}
+
+	// Characters outside of the alphabet must be rejected, also in the
+	// middle of the SIMD blocks:
+	for (int c = 1; c < 256; c++) {
+		if (c == (unsigned char)pad || memchr(chars, c, 64) != NULL)
+			continue;
+
+		enc[500] = (char)c;
+		if (base64_decode_alphabet(enc, enclen, dec, &declen, flags, &alphabet)) {
+			printf("FAIL: %s alphabet: character %d not rejected\n", name, c);
+			fail = true;
+			break;
+		}
+	}
+
+	return fail;
+}
+
+static int
+test_alphabet (int flags)
+{
+	bool fail = false;
+	struct base64_alphabet alphabet;
+	char reversed[64];
+	char dec[10];
+	size_t declen;
+
+	// An alphabet that fits none of the range-based codecs:
+	for (int i = 0; i < 64; i++)
+		reversed[i] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[63 - i];
+
+	fail |= test_alphabet_one(flags, "standard",
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", '=');
+	fail |= test_alphabet_one(flags, "IMAP",
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,", '=');
+	fail |= test_alphabet_one(flags, "bcrypt",
+		"./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", '\0');
+	fail |= test_alphabet_one(flags, "crypt",
+		"./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz", '*');
+	fail |= test_alphabet_one(flags, "reversed", reversed, '=');
+
+	// Without a padding character, the decoder accepts unpadded input:
+	base64_alphabet_init(&alphabet,
+		"./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", '\0');
+	if (!base64_decode_alphabet("..", 2, dec, &declen, flags, &alphabet) || declen != 1 || dec[0] != 0) {
+		printf("FAIL: bcrypt alphabet: decoding of unpadded input failed\n");
+		fail = true;
+	}
+
+	// Invalid alphabets: duplicate characters, padding character in the
+	// alphabet, and characters outside of 7-bit ASCII:
+	if (base64_alphabet_init(&alphabet,
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+A", '=')) {
+		printf("FAIL: alphabet with duplicate character accepted\n");
+		fail = true;
+	}
+	if (base64_alphabet_init(&alphabet,
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", '+')) {
+		printf("FAIL: alphabet with padding character in alphabet accepted\n");
+		fail = true;
+	}
+	if (base64_alphabet_init(&alphabet,
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+\xe9", '=')) {
+		printf("FAIL: alphabet with non-ASCII character accepted\n");
+		fail = true;
+	}
+
+	return fail;
+}
+
+static int
+test_bounded (int flags)
+{
+	bool fail = false;
+	char enc[2100], dec[2100];
+	size_t enclen, declen;
+	size_t plainlen = strlen(moby_dick_plain);
+	const char *wrapped = " Zm9v\nYmFy\nYg==\n";
+
+	// The exact lengths, with and without padding:
+	for (size_t n = 0; n < 10; n++) {
+		base64_encode(moby_dick_plain, n, enc, &enclen, flags);
+		if (base64_encoded_length(n, flags) != enclen) {
+			printf("FAIL: base64_encoded_length(%lu) wrong\n", (unsigned long)n);
+			fail = true;
+		}
+		base64_encode(moby_dick_plain, n, enc, &enclen, flags | BASE64_NOPAD);
+		if (base64_encoded_length(n, flags | BASE64_NOPAD) != enclen
+		    || base64_decoded_length_max(enclen) != n) {
+			printf("FAIL: lengths of unpadded output for %lu bytes wrong\n", (unsigned long)n);
+			fail = true;
+		}
+	}
+
+	// Encode into a buffer of exactly the right size, and one byte less:
+	enclen = base64_encoded_length(plainlen, flags);
+	memset(enc, '#', sizeof (enc));
+	if (!base64_encode_bounded(moby_dick_plain, plainlen, enc, enclen, &outlen, flags)
+	    || outlen != enclen || enc[enclen] != '#') {
+		printf("FAIL: bounded encoding into exact buffer failed\n");
+		fail = true;
+	}
+	memset(enc, '#', sizeof (enc));
+	if (base64_encode_bounded(moby_dick_plain, plainlen, enc, enclen - 1, &outlen, flags)
+	    || enc[0] != '#') {
+		printf("FAIL: bounded encoding into short buffer: no error\n");
+		fail = true;
+	}
+
+	// Decode into buffers from the exact size down, and check that no byte
+	// past the end is touched. The SIMD decoders would normally write past
+	// the output:
+	enclen = strlen(moby_dick_base64);
+	for (size_t cap = plainlen + 2; cap + 64 > plainlen; cap--) {
+		memset(dec, '#', sizeof (dec));
+		int ret = base64_decode_bounded(moby_dick_base64, enclen, dec, cap, &declen, flags);
+
+		if (ret != (cap >= plainlen) || dec[cap] != '#'
+		    || (ret && (declen != plainlen || memcmp(dec, moby_dick_plain, plainlen) != 0))) {
+			printf("FAIL: bounded decoding with capacity %lu failed\n", (unsigned long)cap);
+			fail = true;
+		}
+	}
+
+	// Skipped whitespace and padding:
+	memset(dec, '#', sizeof (dec));
+	if (!base64_decode_bounded(wrapped, strlen(wrapped), dec, 7, &declen, flags | BASE64_IGNORE_SPACE)
+	    || declen != 7 || memcmp(dec, "foobarb", 7) != 0 || dec[7] != '#') {
+		printf("FAIL: bounded decoding of wrapped input failed\n");
+		fail = true;
+	}
+
+	return fail;
+}
+
+static int
+test_policy (int flags)
+{
+	bool fail = false;
+	char enc[2000];
+	size_t enclen, declen;
+	size_t plainlen = strlen(moby_dick_plain);
+	struct base64_state state;
+
+	// Inputs that only some of the policies accept, and their output:
+	static const struct {
+		int flags;
+		const char *in;
+		const char *out;
+	} vec[] = {
+		{ 0,				"Zm9vYh==",		"foob" },
+		{ 0,				"Zm9vYmF=",		"fooba" },
+		{ BASE64_STRICT,		"Zm9vYg==",		"foob" },
+		{ BASE64_STRICT,		"Zm9vYmE=",		"fooba" },
+		{ BASE64_STRICT,		"Zm9vYh==",		NULL },
+		{ BASE64_STRICT,		"Zm9vYmF=",		NULL },
+		{ BASE64_STRICT,		"Zm9vYg",		NULL },
+		{ BASE64_STRICT | BASE64_NOPAD,	"Zm9vYg",		"foob" },
+		{ BASE64_STRICT | BASE64_NOPAD,	"Zm9vYh",		NULL },
+		{ BASE64_STRICT | BASE64_NOPAD,	"Zm9vYmF",		NULL },
+		{ BASE64_FORGIVING,		" Zm9v\r\nYg\f",	"foob" },
+		{ BASE64_FORGIVING,		"Zm9v Yg =\t=",	"foob" },
+		{ BASE64_FORGIVING,		"Zm9vYh",		"foob" },
+		{ BASE64_FORGIVING,		"Zm9vYmE",		"fooba" },
+		{ BASE64_FORGIVING,		"Zm9vYg=",		NULL },
+		{ BASE64_FORGIVING,		"Zm9vY",		NULL },
+		{ BASE64_FORGIVING,		"Zm9v\vYg",		NULL },
+		{ BASE64_FORBID_PAD,		"Zm9vYg",		"foob" },
+		{ BASE64_FORBID_PAD,		"Zm9vYmE",		"fooba" },
+		{ BASE64_FORBID_PAD,		"Zm9vYg==",		NULL },
+		{ BASE64_FORBID_PAD,		"Zm9vYmE=",		NULL },
+		{ BASE64_FORBID_PAD | BASE64_STRICT | BASE64_URLSAFE, "_-_-Yg", "\xff\xef\xfe" "b" },
+		{ BASE64_FORBID_PAD | BASE64_STRICT | BASE64_URLSAFE, "_-_-Yh", NULL },
+	};
+
+	for (size_t i = 0; i < sizeof(vec) / sizeof(vec[0]); i++) {
+		int f = flags | vec[i].flags;
+
+		if (vec[i].out != NULL) {
+			fail |= assert_dec(f, vec[i].in, vec[i].out);
+		}
+		else if (base64_decode(vec[i].in, strlen(vec[i].in), out, &outlen, f)) {
+			printf("FAIL: decoding '%s' with policy %x: no decoding error\n", vec[i].in, vec[i].flags);
+			fail = true;
+		}
+		if (base64_validate(vec[i].in, strlen(vec[i].in), f, NULL, NULL) != (vec[i].out != NULL)) {
+			printf("FAIL: validating '%s' with policy %x: wrong result\n", vec[i].in, vec[i].flags);
+			fail = true;
+		}
+	}
+
+	// The policy is checked when the padding arrives in a stream:
+	base64_stream_decode_init(&state, flags | BASE64_STRICT);
+	if (!base64_stream_decode(&state, "Zm9vY", 5, out, &outlen)
+	    || base64_stream_decode(&state, "h==", 3, out, &outlen)) {
+		printf("FAIL: stream decoding with BASE64_STRICT: no decoding error\n");
+		fail = true;
+	}
+
+	// Long input through the SIMD code, padded and unpadded:
+	fail |= assert_dec(flags | BASE64_STRICT, moby_dick_base64, moby_dick_plain);
+	if (base64_decode(moby_dick_base64, strlen(moby_dick_base64), out, &outlen, flags | BASE64_FORBID_PAD)) {
+		printf("FAIL: decoding padded input with BASE64_FORBID_PAD: no decoding error\n");
+		fail = true;
+	}
+	base64_encode(moby_dick_plain, plainlen, enc, &enclen, flags | BASE64_FORBID_PAD);
+	if (enc[enclen - 1] == '='
+	    || !base64_decode(enc, enclen, out, &declen, flags | BASE64_FORBID_PAD | BASE64_STRICT)
+	    || declen != plainlen || memcmp(out, moby_dick_plain, plainlen) != 0) {
+		printf("FAIL: roundtrip with BASE64_FORBID_PAD failed\n");
+		fail = true;
+	}
+
+	return fail;
+}
+
+static bool
+assert_validate (int flags, const char *src, int ret, size_t len, size_t offset)
+{
+	size_t decoded_len, error_offset;
+
+	if (base64_validate(src, strlen(src), flags, &decoded_len, &error_offset) != ret) {
+		printf("FAIL: validating \"%s\": expected %d\n", src, ret);
+		return true;
+	}
+	if (decoded_len != len || error_offset != offset) {
+		printf("FAIL: validating \"%s\": length %lu, offset %lu; expected %lu, %lu\n", src,
+			(unsigned long)decoded_len, (unsigned long)error_offset,
+			(unsigned long)len, (unsigned long)offset);
+		return true;
+	}
+	return false;
+}
+
+static int
+test_validate (int flags)
+{
+	static const char invalid_set[] = { '\0', -1, '!', '-', ';', '_', '|' };
+	bool fail = false;
+	char enc[2000];
+	size_t enclen = strlen(moby_dick_base64);
+	size_t plainlen = strlen(moby_dick_plain);
+	size_t decoded_len, error_offset;
+
+	fail |= assert_validate(flags, "", 1, 0, 0);
+	fail |= assert_validate(flags, "Zg==", 1, 1, 4);
+	fail |= assert_validate(flags, "Zm8=", 1, 2, 4);
+	fail |= assert_validate(flags, "Zm9vYmFy", 1, 6, 8);
+	fail |= assert_validate(flags, moby_dick_base64, 1, plainlen, enclen);
+
+	// Errors in the padding, and input that ends too early:
+	fail |= assert_validate(flags, "Zm9vYg=", 0, 4, 7);
+	fail |= assert_validate(flags, "Zm9vYg", 0, 4, 6);
+	fail |= assert_validate(flags, "Zm9vY", 0, 3, 5);
+	fail |= assert_validate(flags, "Zm9v=", 0, 3, 4);
+	fail |= assert_validate(flags, "Zm9vY=", 0, 3, 5);
+	fail |= assert_validate(flags, "Zm9vYmF=Zm9v", 0, 5, 8);
+	fail |= assert_validate(flags, "Zm9vYg===", 0, 4, 8);
+
+	// Flags are applied as in the decoder:
+	fail |= assert_validate(flags | BASE64_NOPAD, "Zm9vYg", 1, 4, 6);
+	fail |= assert_validate(flags | BASE64_NOPAD, "Zm9vY", 0, 3, 5);
+	fail |= assert_validate(flags | BASE64_URLSAFE, "-_-_", 1, 3, 4);
+	fail |= assert_validate(flags, "-_-_", 0, 0, 0);
+	fail |= assert_validate(flags | BASE64_IGNORE_SPACE, " Zm9v\r\nYg=\r\n=\r\n", 1, 4, 15);
+	fail |= assert_validate(flags | BASE64_IGNORE_SPACE, "Zm9v Y*==", 0, 3, 6);
+
+	// Corrupt each character of a long input up to the padding, which is
+	// checked by the SIMD code of the codec, and compare with the decoder:
+	memcpy(enc, moby_dick_base64, enclen);
+	for (size_t c = 0U; c < sizeof(invalid_set); ++c) {
+		for (size_t i = 0U; i < enclen && enc[i] != '='; i++) {
+			char backup = enc[i];
+
+			enc[i] = invalid_set[c];
+
+			if (base64_validate(enc, enclen, flags, &decoded_len, &error_offset)
+			    || error_offset != i || decoded_len != i / 4 * 3 + (i % 4) * 3 / 4
+			    || base64_decode(enc, enclen, out, &outlen, flags)) {
+				printf("FAIL: validating invalid input @ %d: wrong result\n", (int)i);
+				fail = true;
+			}
+			enc[i] = backup;
+		}
+	}
+
+	return fail;
+}
+
+// The policies under which the short paths are checked, one at a time:
+static const int policies[] = {
+	0, BASE64_URLSAFE, BASE64_NOPAD, BASE64_STRICT, BASE64_FORBID_PAD,
+};
+
+// Decode `src` with the loops of the codec in `flags`. The in-place decoder
+// never takes the short path:
+static int
+decode_codec (int flags, const char *src, size_t srclen, char *out, size_t *outlen)
+{
+	memcpy(out, src, srclen);
+	return base64_decode_inplace(out, srclen, outlen, flags);
+}
+
+static int
+test_small (int flags, int policy)
+{
+	bool fail = false;
+	char ref[200], enc[200], dec[200];
+	size_t reflen, enclen, declen;
+
+	// One-shot calls on short inputs take a path of their own up to a limit
+	// that depends on the codec, also when it is forced. Check them, forced
+	// and not, against the loops of this codec on all lengths around each
+	// limit. The stream encoder never takes the short path:
+	for (size_t n = 0; n <= 80; n++) {
+		reflen = encode_wrapped(flags | policy, moby_dick_plain, n, ref, 80, 0, 0);
+
+		for (int forced = 0; forced <= 1; forced++) {
+			base64_encode(moby_dick_plain, n, enc, &enclen, forced ? flags | policy : policy);
+
+			if (enclen != reflen || memcmp(enc, ref, enclen) != 0) {
+				printf("FAIL: short encoding of %lu bytes differs\n", (unsigned long)n);
+				fail = true;
+			}
+		}
+		if (decode_codec(flags | policy, ref, reflen, dec, &declen) != 1
+		    || declen != n || memcmp(dec, moby_dick_plain, n) != 0) {
+			printf("FAIL: decoding of %lu bytes failed\n", (unsigned long)n);
+			fail = true;
+			continue;
+		}
+		memcpy(enc, ref, reflen);
+		enclen = reflen;
+
+		for (int forced = 0; forced <= 1; forced++) {
+			const int f = forced ? flags | policy : policy;
+
+			if (base64_decode(enc, enclen, dec, &declen, f) != 1
+			    || declen != n || memcmp(dec, moby_dick_plain, n) != 0) {
+				printf("FAIL: short decoding of %lu bytes failed\n", (unsigned long)n);
+				fail = true;
+			}
+
+			// Malformed input must be rejected as by the codec:
+			for (size_t i = 0; i < enclen; i += 5) {
+				const char c = enc[i];
+
+				enc[i] = '!';
+				if (base64_decode(enc, enclen, dec, &declen, f) != 0) {
+					printf("FAIL: short decoding accepted an invalid character\n");
+					fail = true;
+				}
+				enc[i] = c;
+			}
+			for (size_t len = (enclen > 3) ? enclen - 3 : 0; len < enclen; len++) {
+				if (base64_decode(enc, len, dec, &declen, f)
+				    != decode_codec(flags | policy, enc, len, ref, &reflen)) {
+					printf("FAIL: short decoding of a truncated input differs\n");
+					fail = true;
+				}
+			}
+		}
+	}
+
+	return fail;
+}
+
+static int
+test_fixed (int flags, int policy)
+{
+	bool fail = false;
+	void (* const enc_fixed[]) (const char *, char *, int) = {
+		base64_encode_16, base64_encode_20, base64_encode_32, base64_encode_48, base64_encode_64,
+	};
+	int (* const dec_fixed[]) (const char *, char *, int) = {
+		base64_decode_16, base64_decode_20, base64_decode_32, base64_decode_48, base64_decode_64,
+	};
+	const size_t sizes[] = { 16, 20, 32, 48, 64 };
+	char ref[100], enc[100], dec[100];
+	size_t reflen;
+
+	for (size_t k = 0; k < sizeof (sizes) / sizeof (sizes[0]); k++) {
+		const size_t n = sizes[k];
+
+		// The fixed-width functions must agree with this codec:
+		base64_encode(moby_dick_plain, n, ref, &reflen, flags | policy);
+		memset(enc, 0, sizeof (enc));
+		enc_fixed[k](moby_dick_plain, enc, flags | policy);
+
+		if (reflen != base64_encoded_length(n, policy) || memcmp(enc, ref, reflen) != 0 || enc[reflen] != 0) {
+			printf("FAIL: fixed-width encoding of %lu bytes differs\n", (unsigned long)n);
+			fail = true;
+			continue;
+		}
+		memset(dec, 0, sizeof (dec));
+		if (dec_fixed[k](enc, dec, flags | policy) != 1
+		    || memcmp(dec, moby_dick_plain, n) != 0 || dec[n] != 0) {
+			printf("FAIL: fixed-width decoding of %lu bytes failed\n", (unsigned long)n);
+			fail = true;
+		}
+
+		// Malformed input must be rejected without touching the output:
+		memset(dec, 0, sizeof (dec));
+		for (size_t i = 0; i < reflen; i += 3) {
+			const char c = enc[i];
+
+			enc[i] = '!';
+			if (dec_fixed[k](enc, dec, flags | policy) != 0) {
+				printf("FAIL: fixed-width decoding accepted an invalid character\n");
+				fail = true;
+			}
+			enc[i] = c;
+		}
+
+		// A pad moved within the last quantum makes the input decode
+		// to another length:
+		if (enc[reflen - 1] == '=') {
+			memcpy(enc + reflen - 4, enc[reflen - 2] == '=' ? "AAA=" : "AA==", 4);
+			if (dec_fixed[k](enc, dec, flags | policy) != 0) {
+				printf("FAIL: fixed-width decoding accepted a misplaced pad\n");
+				fail = true;
+			}
+		}
+		for (size_t i = 0; i < n; i++) {
+			if (dec[i] != 0) {
+				printf("FAIL: fixed-width decoding wrote on failure\n");
+				fail = true;
+				break;
+			}
+		}
+	}
+
+	return fail;
+}
+
+static int
+test_batch (int flags, int policy)
+{
+	bool fail = false;
+	static char enc[12000], dec[9000], ref[1000];
+	const char *src[120];
+	size_t srclen[120], offsets[121], decoffsets[121], reflen;
+	int results[120];
+
+	// Items of all small lengths, with one too large for staging:
+	for (size_t i = 0; i < 120; i++) {
+		src[i] = moby_dick_plain + i;
+		srclen[i] = (i == 50) ? 700 : i % 73;
+	}
+	base64_encode_batch(src, srclen, 120, enc, offsets, flags | policy);
+
+	for (size_t i = 0; i < 120; i++) {
+		base64_encode(src[i], srclen[i], ref, &reflen, policy);
+		if (offsets[i + 1] - offsets[i] != reflen || memcmp(enc + offsets[i], ref, reflen) != 0) {
+			printf("FAIL: batch encoding of item %lu differs\n", (unsigned long)i);
+			fail = true;
+		}
+	}
+
+	// Corrupt some of the items to check the result of each:
+	for (size_t i = 0; i < 120; i++) {
+		char *e = enc + offsets[i];
+		const size_t len = offsets[i + 1] - offsets[i];
+
+		src[i] = e;
+		srclen[i] = len;
+		if (i % 7 == 3 && len > 0) {
+			e[len / 2] = '!';
+		}
+		if (i % 11 == 5 && len > 4) {
+			srclen[i] = len - 1;
+		}
+		if (i % 13 == 6 && len > 3 && e[len - 1] == '=') {
+			memcpy(e + len - 3, "B==", 3);
+		}
+	}
+	if (base64_decode_batch(src, srclen, 120, dec, decoffsets, results, flags | policy) > 120) {
+		fail = true;
+	}
+	for (size_t i = 0; i < 120; i++) {
+		const int ret = base64_decode(src[i], srclen[i], ref, &reflen, policy);
+
+		if (results[i] != ret || (ret == 1 && (decoffsets[i + 1] - decoffsets[i] != reflen
+		    || memcmp(dec + decoffsets[i], ref, reflen) != 0))) {
+			printf("FAIL: batch decoding of item %lu differs\n", (unsigned long)i);
+			fail = true;
+		}
+		if (ret != 1 && decoffsets[i + 1] != decoffsets[i]) {
+			printf("FAIL: batch decoding of invalid item %lu has output\n", (unsigned long)i);
+			fail = true;
+		}
+	}
+
+	return fail;
+}
+
+static int
+test_policies (int flags)
+{
+	bool fail = false;
+
+	for (size_t p = 0; p < sizeof (policies) / sizeof (policies[0]); p++) {
+		fail |= test_small(flags, policies[p]);
+		fail |= test_fixed(flags, policies[p]);
+		fail |= test_batch(flags, policies[p]);
+	}
+
+	return fail;
+}
+
+// Cut `len` bytes at `buf` into `cnt` segments, of lengths that vary with
+// `seed`. Some are empty, and the last one holds the rest:
+static void
+iov_split (struct iovec *iov, size_t cnt, const char *buf, size_t len, size_t seed)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		size_t n = (i + 1 == cnt) ? len : (seed * (i + 3) * 7) % 61;
+
+		if (n > len) {
+			n = len;
+		}
+		iov[i].iov_base = (void *) buf;
+		iov[i].iov_len = n;
+		buf += n;
+		len -= n;
+	}
+}
+
+static int
+test_iovec (int flags)
+{
+	bool fail = false;
+	const size_t len = strlen(moby_dick_plain);
+	static char ref[3000], enc[3000], dec[3000];
+	struct iovec src[9], dst[9];
+	size_t reflen, n;
+
+	base64_encode(moby_dick_plain, len, ref, &reflen, flags);
+
+	for (size_t seed = 1; seed < 60; seed += 2) {
+		const size_t cnt = 1 + seed % 9;
+
+		// Encode from segments into segments of exactly the length
+		// of the output:
+		iov_split(src, cnt, moby_dick_plain, len, seed);
+		iov_split(dst, 10 - cnt, enc, reflen, seed + 1);
+
+		if (base64_encodev(src, cnt, dst, 10 - cnt, &n, flags) != 1 || n != reflen || memcmp(enc, ref, n) != 0) {
+			printf("FAIL: scatter/gather encoding differs (seed %lu)\n", (unsigned long)seed);
+			fail = true;
+		}
+
+		// Decode it back the other way around:
+		iov_split(src, 10 - cnt, ref, reflen, seed + 2);
+		iov_split(dst, cnt, dec, len, seed + 3);
+
+		if (base64_decodev(src, 10 - cnt, dst, cnt, &n, flags) != 1 || n != len || memcmp(dec, moby_dick_plain, n) != 0) {
+			printf("FAIL: scatter/gather decoding differs (seed %lu)\n", (unsigned long)seed);
+			fail = true;
+		}
+
+		// Output that does not fit must be reported, and so must
+		// invalid input:
+		iov_split(dst, cnt, dec, len - 1, seed + 3);
+		if (base64_decodev(src, 10 - cnt, dst, cnt, &n, flags) != 0) {
+			printf("FAIL: scatter/gather decoding overflowed (seed %lu)\n", (unsigned long)seed);
+			fail = true;
+		}
+		iov_split(src, cnt, moby_dick_plain, len, seed);
+		iov_split(dst, 10 - cnt, enc, reflen - 1, seed + 1);
+		if (base64_encodev(src, cnt, dst, 10 - cnt, &n, flags) != 0) {
+			printf("FAIL: scatter/gather encoding overflowed (seed %lu)\n", (unsigned long)seed);
+			fail = true;
+		}
+		memcpy(enc, ref, reflen);
+		enc[seed * 31 % reflen] = '@';
+		iov_split(src, 10 - cnt, enc, reflen, seed + 2);
+		iov_split(dst, cnt, dec, len, seed + 3);
+		if (base64_decodev(src, 10 - cnt, dst, cnt, &n, flags) != 0) {
+			printf("FAIL: scatter/gather decoding accepted invalid input (seed %lu)\n", (unsigned long)seed);
+			fail = true;
+		}
+	}
+
+	return fail;
+}
+
+static int
+test_mt (int flags)
+{
+	bool fail = false;
+	const int threads[] = { 1, 2, 3, 8, 0 };
+	const size_t lens[] = { 0, 1000, 98303, 98304, 98305, 300001, 300002 };
+	const size_t maxlen = 300002;
+	char *src = test_bytes(maxlen, 13);
+	char *ref = malloc(maxlen / 3 * 4 + 8);
+	char *enc = malloc(maxlen / 3 * 4 + 8);
+	char *dec = malloc(maxlen);
+	size_t reflen, n, at;
+
+	if (src == NULL || ref == NULL || enc == NULL || dec == NULL) {
+		printf("FAIL: out of memory\n");
+		free(src);
+		free(ref);
+		free(enc);
+		free(dec);
+		return true;
+	}
+
+	// Split any input that has enough chunks, even on a single core:
+	base64_set_parallel_threshold(1);
+
+	for (size_t l = 0; l < sizeof (lens) / sizeof (lens[0]); l++) {
+		const size_t len = lens[l];
+
+		base64_encode(src, len, ref, &reflen, flags);
+
+		for (size_t t = 0; t < sizeof (threads) / sizeof (threads[0]); t++) {
+			const int nthreads = threads[t];
+
+			base64_encode_mt(src, len, enc, &n, flags, nthreads);
+			if (n != reflen || memcmp(enc, ref, n) != 0) {
+				printf("FAIL: multi-threaded encoding of %lu bytes on %d threads differs\n",
+					(unsigned long)len, nthreads);
+				fail = true;
+			}
+			if (base64_decode_mt(ref, reflen, dec, &n, flags, nthreads, &at) != 1 || n != len || at != reflen
+			    || memcmp(dec, src, n) != 0) {
+				printf("FAIL: multi-threaded decoding of %lu bytes on %d threads differs\n",
+					(unsigned long)len, nthreads);
+				fail = true;
+			}
+			if (reflen < 8) {
+				continue;
+			}
+
+			// Invalid input must be found in any chunk, and so must
+			// padding before the end. The error is where
+			// base64_validate() finds it:
+			for (size_t k = 0; k < 4; k++) {
+				const size_t pos[] = { 5, reflen / 3 * 2, reflen - 2 };
+				size_t want;
+
+				memcpy(enc, ref, reflen);
+				if (k < 3) {
+					enc[pos[k]] = '@';
+				}
+				else {
+					memcpy(enc + reflen / 8 * 4, "AA==", 4);
+				}
+				base64_validate(enc, reflen, flags, NULL, &want);
+				if (base64_decode_mt(enc, reflen, dec, &n, flags, nthreads, &at) != 0 || at != want) {
+					printf("FAIL: multi-threaded decoding of invalid input %lu (%d threads) gave offset %lu, expected %lu\n",
+						(unsigned long)k, nthreads, (unsigned long)at, (unsigned long)want);
+					fail = true;
+				}
+			}
+		}
+	}
+
+	// The pool starts again after it was stopped, with pinned workers:
+	base64_mt_shutdown();
+	base64_mt_set_pinning(1);
+	base64_encode_mt(src, maxlen, enc, &n, flags, 4);
+	base64_mt_set_pinning(0);
+	base64_encode(src, maxlen, ref, &reflen, flags);
+	if (n != reflen || memcmp(enc, ref, n) != 0) {
+		printf("FAIL: multi-threaded encoding after shutdown differs\n");
+		fail = true;
+	}
+
+	// Likewise with the calibrated threshold:
+	base64_set_parallel_threshold(0);
+	base64_encode_mt(src, maxlen, enc, &n, flags, 0);
+	if (n != reflen || memcmp(enc, ref, n) != 0) {
+		printf("FAIL: multi-threaded encoding with the calibrated threshold differs\n");
+		fail = true;
+	}
+
+	free(src);
+	free(ref);
+	free(enc);
+	free(dec);
+	return fail;
+}
+
+static int
+test_inplace (int flags)
+{
+	bool fail = false;
+	const size_t lens[] = { 0, 1, 2, 3, 4, 5, 31, 32, 33, 47, 48, 64, 100, 1000, 4097, 100003 };
+	const size_t maxlen = 100003;
+	char *src = test_bytes(maxlen, 9);
+	char *ref = malloc(maxlen / 3 * 4 + maxlen / 19 + 8);
+	char *buf = malloc(maxlen / 3 * 4 + maxlen / 19 + 8);
+	char *dec = malloc(maxlen);
+	struct base64_state state;
+	size_t reflen, n, n1;
+	int ret, ret1;
+
+	if (src == NULL || ref == NULL || buf == NULL || dec == NULL) {
+		printf("FAIL: out of memory\n");
+		free(src);
+		free(ref);
+		free(buf);
+		free(dec);
+		return true;
+	}
+
+	// Encode into a buffer of exactly the encoded length, with every
+	// number of blocks and a partial group of each size:
+	for (size_t len = 0; len < maxlen; len = (len < 200) ? len + 1 : len * 3 + 1) {
+		for (int v = 0; v < 2; v++) {
+			const int fl = flags | ((v == 1) ? BASE64_NOPAD : 0);
+			const size_t enclen = base64_encoded_length(len, fl);
+			char *exact = malloc((enclen > 0) ? enclen : 1);
+
+			if (exact == NULL) {
+				printf("FAIL: out of memory\n");
+				fail = true;
+				continue;
+			}
+			base64_encode(src, len, ref, &reflen, fl);
+			memcpy(exact, src, len);
+			base64_encode_inplace(exact, len, &n, fl);
+
+			if (n != reflen || n != enclen || memcmp(exact, ref, n) != 0) {
+				printf("FAIL: in-place encoding of %lu bytes (variant %d) differs\n", (unsigned long)len, v);
+				fail = true;
+			}
+			free(exact);
+		}
+	}
+
+	// Decode plain, unpadded and wrapped input:
+	for (size_t l = 0; l < sizeof (lens) / sizeof (lens[0]); l++) {
+		const size_t len = lens[l];
+
+		for (int v = 0; v < 3; v++) {
+			const int fl = flags | ((v == 1) ? BASE64_NOPAD : (v == 2) ? BASE64_IGNORE_SPACE : 0);
+
+			if (v < 2) {
+				base64_encode(src, len, ref, &reflen, fl);
+			}
+			else {
+				reflen = encode_wrapped(flags, src, len, ref, len + 1, 76, 1);
+			}
+
+			memcpy(buf, ref, reflen);
+			if (base64_decode_inplace(buf, reflen, &n, fl) != 1 || n != len || memcmp(buf, src, n) != 0) {
+				printf("FAIL: in-place decoding of %lu bytes (variant %d) differs\n", (unsigned long)len, v);
+				fail = true;
+			}
+
+			// Invalid input gives the result and the output of
+			// separate buffers on one thread:
+			if (reflen < 2) {
+				continue;
+			}
+			memcpy(buf, ref, reflen);
+			buf[reflen / 3 * 2] = '@';
+			base64_stream_decode_init(&state, fl);
+			ret1 = base64_stream_decode(&state, buf, reflen, dec, &n1);
+			ret = base64_decode_inplace(buf, reflen, &n, fl);
+
+			if (ret != 0 || ret1 != 0 || n != n1 || memcmp(buf, dec, n) != 0) {
+				printf("FAIL: in-place decoding of invalid input of %lu bytes (variant %d) differs\n",
+					(unsigned long)len, v);
+				fail = true;
+			}
+		}
+	}
+
+	free(src);
+	free(ref);
+	free(buf);
+	free(dec);
+	return fail;
+}
+
+static int
+test_nontemporal (int flags)
+{
+	bool fail = false;
+	const size_t lens[] = { 0, 1, 47, 100, 1000, 5000, 70001 };
+	const size_t maxlen = 70001;
+	char *src = test_bytes(maxlen, 7);
+	char *ref = malloc(maxlen / 3 * 4 + 8);
+	char *buf = malloc(maxlen / 3 * 4 + 72);
+	char *dec = malloc(maxlen);
+	size_t reflen, n;
+
+	if (src == NULL || ref == NULL || buf == NULL || dec == NULL) {
+		printf("FAIL: out of memory\n");
+		free(src);
+		free(ref);
+		free(buf);
+		free(dec);
+		return true;
+	}
+
+	// The output is the same at any alignment, including those that the
+	// non-temporal stores cannot reach:
+	for (size_t l = 0; l < sizeof (lens) / sizeof (lens[0]); l++) {
+		const size_t len = lens[l];
+
+		base64_encode(src, len, ref, &reflen, flags);
+
+		for (size_t off = 0; off < 68; off += (off < 8) ? 1 : 20) {
+			base64_encode(src, len, buf + off, &n, flags | BASE64_NONTEMPORAL);
+			if (n != reflen || memcmp(buf + off, ref, n) != 0) {
+				printf("FAIL: non-temporal encoding of %lu bytes at offset %lu differs\n",
+					(unsigned long)len, (unsigned long)off);
+				fail = true;
+			}
+		}
+
+		// The decoder ignores the flag:
+		if (base64_decode(ref, reflen, dec, &n, flags | BASE64_NONTEMPORAL) != 1
+		    || n != len || memcmp(dec, src, n) != 0) {
+			printf("FAIL: decoding of %lu bytes with the non-temporal flag differs\n", (unsigned long)len);
+			fail = true;
+		}
+	}
+
+	free(src);
+	free(ref);
+	free(buf);
+	free(dec);
+	return fail;
+}
+
+// Feed `srclen` bytes to the stream decoder in blocks of the given sizes, the
+// last one taking the rest, on `nthreads` threads. Returns the result of the
+// block that failed, or of the last one:
+static int
+stream_decode_blocks (const char *src, size_t srclen, char *out, size_t *outlen, int flags, int nthreads, const size_t *blocks, size_t nblocks)
+{
+	struct base64_state state;
+	size_t off = 0, n;
+	int ret = 1;
+
+	base64_stream_decode_init(&state, flags);
+	base64_stream_set_threads(&state, nthreads);
+	*outlen = 0;
+
+	for (size_t i = 0; off < srclen && ret == 1; i++) {
+		const size_t b = (i < nblocks && blocks[i] < srclen - off) ? blocks[i] : srclen - off;
+
+		ret = base64_stream_decode(&state, src + off, b, out + *outlen, &n);
+		*outlen += n;
+		off += b;
+	}
+	return ret;
+}
+
+static int
+test_stream_mt (int flags)
+{
+	bool fail = false;
+	const size_t len = 400003;
+	const size_t blocks[] = { 1, 200000, 2, 150001 };
+	const size_t nblocks = sizeof (blocks) / sizeof (blocks[0]);
+	char *src = test_bytes(len, 11);
+	char *ref = malloc(len / 3 * 4 + 8);
+	char *enc = malloc(len / 3 * 4 + 8);
+	char *dec = malloc(len);
+	char *dec1 = malloc(len);
+	struct base64_state state;
+	size_t reflen, n, n1, off = 0, total = 0;
+	int ret, ret1;
+
+	if (src == NULL || ref == NULL || enc == NULL || dec == NULL || dec1 == NULL) {
+		printf("FAIL: out of memory\n");
+		free(src);
+		free(ref);
+		free(enc);
+		free(dec);
+		free(dec1);
+		return true;
+	}
+	base64_set_parallel_threshold(1);
+	base64_encode(src, len, ref, &reflen, flags);
+
+	// Blocks of odd sizes leave the state off the group boundaries:
+	base64_stream_encode_init(&state, flags);
+	base64_stream_set_threads(&state, 4);
+
+	for (size_t i = 0; off < len; i++) {
+		const size_t b = (i < nblocks && blocks[i] < len - off) ? blocks[i] : len - off;
+
+		base64_stream_encode(&state, src + off, b, enc + total, &n);
+		total += n;
+		off += b;
+	}
+	base64_stream_encode_final(&state, enc + total, &n);
+	total += n;
+
+	if (total != reflen || memcmp(enc, ref, reflen) != 0) {
+		printf("FAIL: multi-threaded stream encoding differs\n");
+		fail = true;
+	}
+
+	if (stream_decode_blocks(ref, reflen, dec, &n, flags, 0, blocks, nblocks) != 1
+	    || n != len || memcmp(dec, src, len) != 0) {
+		printf("FAIL: multi-threaded stream decoding differs\n");
+		fail = true;
+	}
+
+	// On invalid input, the result and the output are those of a single
+	// thread, wherever the error is:
+	for (size_t k = 0; k < 3; k++) {
+		const size_t pos[] = { 3, reflen / 2, reflen - 70000 };
+
+		memcpy(enc, ref, reflen);
+		enc[pos[k]] = '@';
+		ret1 = stream_decode_blocks(enc, reflen, dec1, &n1, flags, 1, blocks, nblocks);
+		ret = stream_decode_blocks(enc, reflen, dec, &n, flags, 4, blocks, nblocks);
+
+		if (ret != 0 || ret != ret1 || n != n1 || memcmp(dec, dec1, n) != 0) {
+			printf("FAIL: multi-threaded stream decoding of invalid input %lu differs\n", (unsigned long)k);
+			fail = true;
+		}
+	}
+	base64_set_parallel_threshold(0);
+
+	free(src);
+	free(ref);
+	free(enc);
+	free(dec);
+	free(dec1);
+	return fail;
+}
+
+static int
+test_codec_per_state (int flags)
+{
+	bool fail = false;
+	const char *src = moby_dick_base64;
+	size_t srclen = strlen(src);
+	size_t len = srclen / 2;
+	char dec[2100];
+
+	// Interleave a stream of this codec with one of each codec that is not
+	// in the build, whose functions are stubs. Each state must keep the
+	// codec that it was initialized with:
+	for (size_t i = 0; codecs[i]; i++) {
+		struct base64_state a, b;
+		size_t alen, blen, total;
+
+		if (codec_supported(1 << i)) {
+			continue;
+		}
+		base64_stream_decode_init(&a, flags);
+		base64_stream_decode_init(&b, 1 << i);
+
+		if (base64_stream_decode(&a, src, len, dec, &alen) != 1
+		    || base64_stream_decode(&b, src, len, dec + alen, &blen) != -1
+		    || base64_stream_decode(&a, src + len, srclen - len, dec + alen, &total) != 1) {
+			printf("FAIL: stream state lost its codec to a %s stream\n", codecs[i]);
+			fail = true;
+			continue;
+		}
+		total += alen;
+		if (total != strlen(moby_dick_plain) || memcmp(dec, moby_dick_plain, total) != 0) {
+			printf("FAIL: stream decoding next to a %s stream gave wrong output\n", codecs[i]);
+			fail = true;
+		}
+	}
+
+	return fail;
+}
+
 static int
 test_one_codec (const char *codec, int flags)
 {
@@ -362,6 +1789,21 @@ test_one_codec (const char *codec, int flags)
 	fail |= test_char_table(flags, true); /* test for out-of-bound input read */
 	fail |= test_streaming(flags);
 	fail |= test_invalid_dec_input(flags);
+	fail |= test_urlsafe(flags);
+	fail |= test_alphabet(flags);
+	fail |= test_wrap(flags);
+	fail |= test_ignore_space(flags);
+	fail |= test_ignore_set(flags);
+	fail |= test_validate(flags);
+	fail |= test_policy(flags);
+	fail |= test_bounded(flags);
+	fail |= test_codec_per_state(flags);
+	fail |= test_policies(flags);
+	fail |= test_iovec(flags);
+	fail |= test_nontemporal(flags);
+	fail |= test_inplace(flags);
+	fail |= test_mt(flags);
+	fail |= test_stream_mt(flags);
 
 	if (!fail)
 		puts("  all tests passed.");